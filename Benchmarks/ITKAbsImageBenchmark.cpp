@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKAbsImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKAbsImageBenchmark()
+  : ITKBenchmarkBase("ITKAbsImage")
+  {
+  }
+  virtual ~ITKAbsImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKAbsImageBenchmark(const ITKAbsImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKAbsImageBenchmark&);       // Operator '=' Not Implemented
+};
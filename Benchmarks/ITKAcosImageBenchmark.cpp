@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKAcosImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKAcosImageBenchmark()
+  : ITKBenchmarkBase("ITKAcosImage")
+  {
+  }
+  virtual ~ITKAcosImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKAcosImageBenchmark(const ITKAcosImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKAcosImageBenchmark&);        // Operator '=' Not Implemented
+};
@@ -0,0 +1,51 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/FloatFilterParameter.h>
+#include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
+
+class ITKAdaptiveHistogramEqualizationImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKAdaptiveHistogramEqualizationImageBenchmark()
+  : ITKBenchmarkBase("ITKAdaptiveHistogramEqualizationImage")
+  {
+  }
+  virtual ~ITKAdaptiveHistogramEqualizationImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      FloatVec3_t d3d_var = CastStdToVec3<std::vector<unsigned int>, FloatVec3_t, float>(std::vector<unsigned int>(3, 5));
+      var.setValue(d3d_var);
+      filter->setProperty("Radius", var);
+    }
+    {
+      float d3d_var = StaticCastScalar<float, float, float>(0.3f);
+      var.setValue(d3d_var);
+      filter->setProperty("Alpha", var);
+    }
+    {
+      float d3d_var = StaticCastScalar<float, float, float>(0.3f);
+      var.setValue(d3d_var);
+      filter->setProperty("Beta", var);
+    }
+  }
+
+private:
+  ITKAdaptiveHistogramEqualizationImageBenchmark(const ITKAdaptiveHistogramEqualizationImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKAdaptiveHistogramEqualizationImageBenchmark&);                                 // Operator '=' Not Implemented
+};
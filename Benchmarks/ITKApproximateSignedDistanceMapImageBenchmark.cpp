@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKApproximateSignedDistanceMapImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKApproximateSignedDistanceMapImageBenchmark()
+  : ITKBenchmarkBase("ITKApproximateSignedDistanceMapImage")
+  {
+  }
+  virtual ~ITKApproximateSignedDistanceMapImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("InsideValue", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+  }
+
+private:
+  ITKApproximateSignedDistanceMapImageBenchmark(const ITKApproximateSignedDistanceMapImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKApproximateSignedDistanceMapImageBenchmark&);                                // Operator '=' Not Implemented
+};
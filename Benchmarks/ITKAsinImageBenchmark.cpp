@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKAsinImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKAsinImageBenchmark()
+  : ITKBenchmarkBase("ITKAsinImage")
+  {
+  }
+  virtual ~ITKAsinImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKAsinImageBenchmark(const ITKAsinImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKAsinImageBenchmark&);        // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKAtanImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKAtanImageBenchmark()
+  : ITKBenchmarkBase("ITKAtanImage")
+  {
+  }
+  virtual ~ITKAtanImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKAtanImageBenchmark(const ITKAtanImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKAtanImageBenchmark&);        // Operator '=' Not Implemented
+};
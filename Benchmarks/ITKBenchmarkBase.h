@@ -0,0 +1,292 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#ifndef _ITKBenchmarkBase_h_
+#define _ITKBenchmarkBase_h_
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief The ITKBenchmarkBase class runs a filter of the ITKImageProcessing plugin
+ * on a synthetic image and prints the median time, the throughput and the peak
+ * memory as a CSV line. The filter is run with its default parameters; generated
+ * benchmarks override SetParameters() to set the defaults of the JSON description
+ * of the filter explicitly.
+ */
+class ITKBenchmarkBase
+{
+
+public:
+  ITKBenchmarkBase(const QString& filterName)
+  : m_FilterName(filterName)
+  {
+  }
+  virtual ~ITKBenchmarkBase()
+  {
+  }
+
+  static QString CsvHeader()
+  {
+    return QString("filter,pixel_type,dimension,size,voxels,threads,simd,repetitions,median_seconds,min_seconds,voxels_per_second,peak_memory_mb,status");
+  }
+
+  /**
+   * @brief Run Runs the filter 'repetitions' times on a 'dimension'-D image of
+   * 'size' pixels along each axis and prints the CSV line of the results.
+   */
+  int Run(const QString& pixelType, int dimension, int size, int threads, int repetitions)
+  {
+    if(pixelType == "uint8")
+    {
+      return Run<uint8_t>(pixelType, dimension, size, threads, repetitions);
+    }
+    if(pixelType == "uint16")
+    {
+      return Run<uint16_t>(pixelType, dimension, size, threads, repetitions);
+    }
+    if(pixelType == "float")
+    {
+      return Run<float>(pixelType, dimension, size, threads, repetitions);
+    }
+    if(pixelType == "double")
+    {
+      return Run<double>(pixelType, dimension, size, threads, repetitions);
+    }
+    QVector<double> times;
+    PrintResult(pixelType, dimension, size, threads, times, "unknown pixel type");
+    return 0;
+  }
+
+protected:
+  /**
+   * @brief SetParameters Sets the parameters of the filter before it is executed.
+   */
+  virtual void SetParameters(AbstractFilter::Pointer filter)
+  {
+    (void)filter;
+  }
+
+  /**
+   * @brief StaticCastScalar Same as ITKImageBase::StaticCastScalar so that generated code can be shared.
+   */
+  template <typename InputType, typename OutputType, typename unused> OutputType StaticCastScalar(const InputType& val) const
+  {
+    return static_cast<OutputType>(val);
+  }
+
+  /**
+   * @brief CastStdToVec3 Same as ITKImageBase::CastStdToVec3 so that generated code can be shared.
+   */
+  template <typename InputType, typename OutputType, typename ComponentType> OutputType CastStdToVec3(const InputType& inputVector) const
+  {
+    OutputType outputVec3;
+    if(inputVector.size() > 0)
+    {
+      outputVec3.x = static_cast<ComponentType>(inputVector[0]);
+      if(inputVector.size() > 1)
+      {
+        outputVec3.y = static_cast<ComponentType>(inputVector[1]);
+        if(inputVector.size() > 2)
+        {
+          outputVec3.z = static_cast<ComponentType>(inputVector[2]);
+        }
+      }
+    }
+    return outputVec3;
+  }
+
+private:
+  QString m_FilterName;
+
+  template <typename PixelType> int Run(const QString& pixelType, int dimension, int size, int threads, int repetitions)
+  {
+    QVector<double> times;
+    IFilterFactory::Pointer filterFactory = FilterManager::Instance()->getFactoryFromClassName(m_FilterName);
+    if(nullptr == filterFactory.get())
+    {
+      PrintResult(pixelType, dimension, size, threads, times, "unavailable");
+      return 0;
+    }
+    DataArrayPath path("BenchmarkContainer", "BenchmarkAttributeMatrix", "BenchmarkArray");
+    for(int r = 0; r < repetitions; r++)
+    {
+      // The input is modified in place: recreate it for every repetition, out of the timed section.
+      DataContainerArray::Pointer containerArray = CreateVolume<PixelType>(path, dimension, size);
+      AbstractFilter::Pointer filter = filterFactory->create();
+      SetInputArrays(filter, path);
+      SetParameters(filter);
+      filter->setProperty("SaveAsNewArray", false);
+      filter->setProperty("NumberOfThreads", threads);
+      filter->setDataContainerArray(containerArray);
+      QElapsedTimer timer;
+      timer.start();
+      filter->execute();
+      const double seconds = static_cast<double>(timer.nsecsElapsed()) * 1.0e-9;
+      if(filter->getErrorCondition() < 0)
+      {
+        PrintResult(pixelType, dimension, size, threads, times, QString("error %1").arg(filter->getErrorCondition()));
+        return 0;
+      }
+      times.push_back(seconds);
+    }
+    PrintResult(pixelType, dimension, size, threads, times, "ok");
+    return 0;
+  }
+
+  // Creates a deterministic image: a bright sphere on a gradient background plus
+  // noise, with values in [0, 255] whatever the pixel type.
+  template <typename PixelType> static DataContainerArray::Pointer CreateVolume(const DataArrayPath& path, int dimension, int size)
+  {
+    QVector<size_t> dimensions(3, 1);
+    for(int i = 0; i < dimension; i++)
+    {
+      dimensions[i] = static_cast<size_t>(size);
+    }
+    DataContainer::Pointer container = DataContainer::New(path.getDataContainerName());
+    ImageGeom::Pointer imageGeometry = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeometry->setResolution(1.0f, 1.0f, 1.0f);
+    imageGeometry->setOrigin(0.0f, 0.0f, 0.0f);
+    imageGeometry->setDimensions(dimensions[0], dimensions[1], dimensions[2]);
+    container->setGeometry(imageGeometry);
+    AttributeMatrix::Pointer matrixArray = container->createAndAddAttributeMatrix(dimensions, path.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    QVector<size_t> arrayDimensions(1, 1);
+    typename DataArray<PixelType>::Pointer data = DataArray<PixelType>::CreateArray(dimensions, arrayDimensions, path.getDataArrayName(), true);
+    PixelType* buffer = data->getPointer(0);
+    const double center = static_cast<double>(size) / 2.0;
+    const double radius2 = (static_cast<double>(size) / 4.0) * (static_cast<double>(size) / 4.0);
+    unsigned int seed = 12345;
+    size_t index = 0;
+    for(size_t z = 0; z < dimensions[2]; z++)
+    {
+      for(size_t y = 0; y < dimensions[1]; y++)
+      {
+        for(size_t x = 0; x < dimensions[0]; x++, index++)
+        {
+          double dx = static_cast<double>(x) - center;
+          double dy = static_cast<double>(y) - center;
+          double dz = (dimension == 3 ? static_cast<double>(z) - center : 0.0);
+          double value = (dx * dx + dy * dy + dz * dz < radius2 ? 200.0 : 50.0 * static_cast<double>(x) / static_cast<double>(size));
+          seed = seed * 1103515245u + 12345u;
+          value += static_cast<double>((seed >> 16) % 32);
+          buffer[index] = static_cast<PixelType>(std::min(value, 255.0));
+        }
+      }
+    }
+    matrixArray->addAttributeArray(path.getDataArrayName(), data);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    containerArray->addDataContainer(container);
+    return containerArray;
+  }
+
+  // Points the selected array and every other input array of the filter (mask,
+  // markers, reference image...) to the synthetic image.
+  static void SetInputArrays(AbstractFilter::Pointer filter, const DataArrayPath& path)
+  {
+    QVariant var;
+    var.setValue(path);
+    const QMetaObject* metaObject = filter->metaObject();
+    for(int i = 0; i < metaObject->propertyCount(); i++)
+    {
+      QMetaProperty property = metaObject->property(i);
+      if(property.userType() == qMetaTypeId<DataArrayPath>())
+      {
+        filter->setProperty(property.name(), var);
+      }
+    }
+  }
+
+  static size_t GetPeakResidentSetSize()
+  {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+      return static_cast<size_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+      return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss); // bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
+  }
+
+  void PrintResult(const QString& pixelType, int dimension, int size, int threads, const QVector<double>& times, const QString& status) const
+  {
+    size_t voxels = 1;
+    for(int i = 0; i < dimension; i++)
+    {
+      voxels *= static_cast<size_t>(size);
+    }
+    double median = 0.0;
+    double minimum = 0.0;
+    double throughput = 0.0;
+    if(!times.isEmpty())
+    {
+      QVector<double> sorted = times;
+      std::sort(sorted.begin(), sorted.end());
+      const int count = sorted.size();
+      median = (count % 2 == 1 ? sorted[count / 2] : 0.5 * (sorted[count / 2 - 1] + sorted[count / 2]));
+      minimum = sorted[0];
+      throughput = (median > 0.0 ? static_cast<double>(voxels) / median : 0.0);
+    }
+    const double peakMemory = static_cast<double>(GetPeakResidentSetSize()) / (1024.0 * 1024.0);
+    // Instruction set requested for the unary math kernels, set by the parent process
+    QString simd = QString::fromLocal8Bit(qgetenv(ITKImageProcessingConstants::SIMDEnvironmentVariable.toLatin1().constData()));
+    if(simd.isEmpty())
+    {
+      simd = "auto";
+    }
+    QString line = QString("%1,%2,%3,%4,%5,%6,%7,%8,%9,%10,%11,%12,%13")
+                       .arg(m_FilterName)
+                       .arg(pixelType)
+                       .arg(dimension)
+                       .arg(size)
+                       .arg(voxels)
+                       .arg(threads)
+                       .arg(simd)
+                       .arg(times.size())
+                       .arg(median, 0, 'g', 6)
+                       .arg(minimum, 0, 'g', 6)
+                       .arg(throughput, 0, 'g', 6)
+                       .arg(peakMemory, 0, 'f', 1)
+                       .arg(status);
+    std::cout << line.toStdString() << std::endl;
+  }
+
+  ITKBenchmarkBase(const ITKBenchmarkBase&); // Copy Constructor Not Implemented
+  void operator=(const ITKBenchmarkBase&);   // Operator '=' Not Implemented
+};
+
+#endif
@@ -0,0 +1,51 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKBinaryContourImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKBinaryContourImageBenchmark()
+  : ITKBenchmarkBase("ITKBinaryContourImage")
+  {
+  }
+  virtual ~ITKBinaryContourImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("BackgroundValue", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("ForegroundValue", var);
+    }
+  }
+
+private:
+  ITKBinaryContourImageBenchmark(const ITKBinaryContourImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKBinaryContourImageBenchmark&);                 // Operator '=' Not Implemented
+};
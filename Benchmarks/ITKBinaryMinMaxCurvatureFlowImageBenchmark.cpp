@@ -0,0 +1,56 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKBinaryMinMaxCurvatureFlowImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKBinaryMinMaxCurvatureFlowImageBenchmark()
+  : ITKBenchmarkBase("ITKBinaryMinMaxCurvatureFlowImage")
+  {
+  }
+  virtual ~ITKBinaryMinMaxCurvatureFlowImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.05);
+      var.setValue(d3d_var);
+      filter->setProperty("TimeStep", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(5u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfIterations", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(2);
+      var.setValue(d3d_var);
+      filter->setProperty("StencilRadius", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Threshold", var);
+    }
+  }
+
+private:
+  ITKBinaryMinMaxCurvatureFlowImageBenchmark(const ITKBinaryMinMaxCurvatureFlowImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKBinaryMinMaxCurvatureFlowImageBenchmark&);                             // Operator '=' Not Implemented
+};
@@ -0,0 +1,50 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKBinaryProjectionImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKBinaryProjectionImageBenchmark()
+  : ITKBenchmarkBase("ITKBinaryProjectionImage")
+  {
+  }
+  virtual ~ITKBinaryProjectionImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("ProjectionDimension", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("ForegroundValue", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("BackgroundValue", var);
+    }
+  }
+
+private:
+  ITKBinaryProjectionImageBenchmark(const ITKBinaryProjectionImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKBinaryProjectionImageBenchmark&);                    // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKBinaryThinningImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKBinaryThinningImageBenchmark()
+  : ITKBenchmarkBase("ITKBinaryThinningImage")
+  {
+  }
+  virtual ~ITKBinaryThinningImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKBinaryThinningImageBenchmark(const ITKBinaryThinningImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKBinaryThinningImageBenchmark&);                  // Operator '=' Not Implemented
+};
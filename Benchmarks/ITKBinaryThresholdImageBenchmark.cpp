@@ -0,0 +1,56 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKBinaryThresholdImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKBinaryThresholdImageBenchmark()
+  : ITKBenchmarkBase("ITKBinaryThresholdImage")
+  {
+  }
+  virtual ~ITKBinaryThresholdImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("LowerThreshold", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255.0);
+      var.setValue(d3d_var);
+      filter->setProperty("UpperThreshold", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("InsideValue", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+  }
+
+private:
+  ITKBinaryThresholdImageBenchmark(const ITKBinaryThresholdImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKBinaryThresholdImageBenchmark&);                   // Operator '=' Not Implemented
+};
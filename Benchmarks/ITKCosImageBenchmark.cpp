@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKCosImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKCosImageBenchmark()
+  : ITKBenchmarkBase("ITKCosImage")
+  {
+  }
+  virtual ~ITKCosImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKCosImageBenchmark(const ITKCosImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKCosImageBenchmark&);       // Operator '=' Not Implemented
+};
@@ -0,0 +1,55 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKCurvatureAnisotropicDiffusionImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKCurvatureAnisotropicDiffusionImageBenchmark()
+  : ITKBenchmarkBase("ITKCurvatureAnisotropicDiffusionImage")
+  {
+  }
+  virtual ~ITKCurvatureAnisotropicDiffusionImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0625);
+      var.setValue(d3d_var);
+      filter->setProperty("TimeStep", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(3.0);
+      var.setValue(d3d_var);
+      filter->setProperty("ConductanceParameter", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("ConductanceScalingUpdateInterval", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(5u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfIterations", var);
+    }
+  }
+
+private:
+  ITKCurvatureAnisotropicDiffusionImageBenchmark(const ITKCurvatureAnisotropicDiffusionImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKCurvatureAnisotropicDiffusionImageBenchmark&);                                 // Operator '=' Not Implemented
+};
@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKCurvatureFlowImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKCurvatureFlowImageBenchmark()
+  : ITKBenchmarkBase("ITKCurvatureFlowImage")
+  {
+  }
+  virtual ~ITKCurvatureFlowImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.05);
+      var.setValue(d3d_var);
+      filter->setProperty("TimeStep", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(5u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfIterations", var);
+    }
+  }
+
+private:
+  ITKCurvatureFlowImageBenchmark(const ITKCurvatureFlowImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKCurvatureFlowImageBenchmark&);                 // Operator '=' Not Implemented
+};
@@ -0,0 +1,50 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+
+class ITKDanielssonDistanceMapImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKDanielssonDistanceMapImageBenchmark()
+  : ITKBenchmarkBase("ITKDanielssonDistanceMapImage")
+  {
+  }
+  virtual ~ITKDanielssonDistanceMapImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("InputIsBinary", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("SquaredDistance", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("UseImageSpacing", var);
+    }
+  }
+
+private:
+  ITKDanielssonDistanceMapImageBenchmark(const ITKDanielssonDistanceMapImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKDanielssonDistanceMapImageBenchmark&);                         // Operator '=' Not Implemented
+};
@@ -0,0 +1,53 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/SimpleITKEnums.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKDilateObjectMorphologyImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKDilateObjectMorphologyImageBenchmark()
+  : ITKBenchmarkBase("ITKDilateObjectMorphologyImage")
+  {
+  }
+  virtual ~ITKDilateObjectMorphologyImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1);
+      var.setValue(d3d_var);
+      filter->setProperty("ObjectValue", var);
+    }
+    {
+      FloatVec3_t d3d_var = CastStdToVec3<std::vector<unsigned int>, FloatVec3_t, float>(std::vector<unsigned int>(3, 1));
+      var.setValue(d3d_var);
+      filter->setProperty("KernelRadius", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(itk::simple::sitkBall);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelType", var);
+    }
+  }
+
+private:
+  ITKDilateObjectMorphologyImageBenchmark(const ITKDilateObjectMorphologyImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKDilateObjectMorphologyImageBenchmark&);                          // Operator '=' Not Implemented
+};
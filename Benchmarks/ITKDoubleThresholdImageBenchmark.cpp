@@ -0,0 +1,72 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKDoubleThresholdImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKDoubleThresholdImageBenchmark()
+  : ITKBenchmarkBase("ITKDoubleThresholdImage")
+  {
+  }
+  virtual ~ITKDoubleThresholdImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Threshold1", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Threshold2", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(254.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Threshold3", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Threshold4", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("InsideValue", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+  }
+
+private:
+  ITKDoubleThresholdImageBenchmark(const ITKDoubleThresholdImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKDoubleThresholdImageBenchmark&);                   // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKExpImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKExpImageBenchmark()
+  : ITKBenchmarkBase("ITKExpImage")
+  {
+  }
+  virtual ~ITKExpImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKExpImageBenchmark(const ITKExpImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKExpImageBenchmark&);       // Operator '=' Not Implemented
+};
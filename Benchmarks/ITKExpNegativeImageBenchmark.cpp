@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKExpNegativeImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKExpNegativeImageBenchmark()
+  : ITKBenchmarkBase("ITKExpNegativeImage")
+  {
+  }
+  virtual ~ITKExpNegativeImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKExpNegativeImageBenchmark(const ITKExpNegativeImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKExpNegativeImageBenchmark&);               // Operator '=' Not Implemented
+};
@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKFFTNormalizedCorrelationImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKFFTNormalizedCorrelationImageBenchmark()
+  : ITKBenchmarkBase("ITKFFTNormalizedCorrelationImage")
+  {
+  }
+  virtual ~ITKFFTNormalizedCorrelationImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("RequiredNumberOfOverlappingPixels", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("RequiredFractionOfOverlappingPixels", var);
+    }
+  }
+
+private:
+  ITKFFTNormalizedCorrelationImageBenchmark(const ITKFFTNormalizedCorrelationImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKFFTNormalizedCorrelationImageBenchmark&);                            // Operator '=' Not Implemented
+};
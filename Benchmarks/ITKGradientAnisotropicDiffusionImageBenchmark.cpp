@@ -0,0 +1,55 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKGradientAnisotropicDiffusionImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKGradientAnisotropicDiffusionImageBenchmark()
+  : ITKBenchmarkBase("ITKGradientAnisotropicDiffusionImage")
+  {
+  }
+  virtual ~ITKGradientAnisotropicDiffusionImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.125);
+      var.setValue(d3d_var);
+      filter->setProperty("TimeStep", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(3);
+      var.setValue(d3d_var);
+      filter->setProperty("ConductanceParameter", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("ConductanceScalingUpdateInterval", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(5u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfIterations", var);
+    }
+  }
+
+private:
+  ITKGradientAnisotropicDiffusionImageBenchmark(const ITKGradientAnisotropicDiffusionImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKGradientAnisotropicDiffusionImageBenchmark&);                                // Operator '=' Not Implemented
+};
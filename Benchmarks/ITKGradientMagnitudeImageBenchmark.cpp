@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+
+class ITKGradientMagnitudeImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKGradientMagnitudeImageBenchmark()
+  : ITKBenchmarkBase("ITKGradientMagnitudeImage")
+  {
+  }
+  virtual ~ITKGradientMagnitudeImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("UseImageSpacing", var);
+    }
+  }
+
+private:
+  ITKGradientMagnitudeImageBenchmark(const ITKGradientMagnitudeImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKGradientMagnitudeImageBenchmark&);                     // Operator '=' Not Implemented
+};
@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKHMaximaImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKHMaximaImageBenchmark()
+  : ITKBenchmarkBase("ITKHMaximaImage")
+  {
+  }
+  virtual ~ITKHMaximaImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(2.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Height", var);
+    }
+  }
+
+private:
+  ITKHMaximaImageBenchmark(const ITKHMaximaImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKHMaximaImageBenchmark&);           // Operator '=' Not Implemented
+};
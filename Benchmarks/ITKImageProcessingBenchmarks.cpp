@@ -0,0 +1,244 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+// Runs the ITK filters of the ITKImageProcessing plugin on synthetic 2D and 3D
+// volumes and reports median time, throughput and peak memory as CSV.
+//
+// Every (filter, pixel type, dimension, size, SIMD) case is run in its own process so
+// that the peak memory of a case is not hidden by the high-water mark of the
+// previous ones.
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QProcess>
+#include <QtCore/QProcessEnvironment>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+
+#include "ITKBenchmarkBase.h"
+#include "ITKImageProcessingBenchmarkFilters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Runs one case in the current process and prints its CSV line.
+// -----------------------------------------------------------------------------
+int RunCase(const QString& filterName, const QString& pixelType, int dimension, int size, int threads, int repetitions)
+{
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+  // Generated benchmarks set the parameters of the filter explicitly, the other
+  // filters run with the defaults of their constructor.
+  std::shared_ptr<ITKBenchmarkBase> benchmark = BenchmarkFilters::CreateBenchmark(filterName);
+  if(nullptr == benchmark.get())
+  {
+    benchmark = std::shared_ptr<ITKBenchmarkBase>(new ITKBenchmarkBase(filterName));
+  }
+  return benchmark->Run(pixelType, dimension, size, threads, repetitions);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList SplitList(const QString& value)
+{
+  return value.split(',', QString::SkipEmptyParts);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PrintUsage()
+{
+  std::cout << "Usage: ITKImageProcessingBenchmarks [options]\n"
+            << "  --filters <f1,f2,...>    Filters to run (default: all the filters tested in Test/CMakeLists.txt)\n"
+            << "  --types <t1,t2,...>      Pixel types among uint8, uint16, float, double (default: uint8,uint16,float)\n"
+            << "  --dimensions <d1,...>    Image dimensions among 2, 3 (default: 2,3)\n"
+            << "  --sizes <s1,s2,...>      Edge length of the images in pixels (default: 256, e.g. 256,512,1024)\n"
+            << "  --repetitions <n>        Number of runs per case, the median is reported (default: 5)\n"
+            << "  --threads <n>            NumberOfThreads of the filters, 0 for ITK's default (default: 0)\n"
+            << "  --simd <s1,s2,...>       Instruction sets of the unary math kernels among auto, off, none, sse2, avx2,\n"
+            << "                           avx512 (default: auto, the best supported one; off runs the ITK filters)\n"
+            << "  --output <file.csv>      Writes the results to a CSV file in addition to the standard output\n";
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("ITKImageProcessingBenchmarks");
+  QCoreApplication app(argc, argv);
+
+  QStringList filters;
+  for(int i = 0; nullptr != BenchmarkFilters::Names[i]; i++)
+  {
+    filters << QString(BenchmarkFilters::Names[i]);
+  }
+  QStringList types = QStringList() << "uint8"
+                                    << "uint16"
+                                    << "float";
+  QStringList dimensions = QStringList() << "2"
+                                         << "3";
+  QStringList sizes = QStringList() << "256";
+  int repetitions = 5;
+  int threads = 0;
+  QStringList simdSets = QStringList() << "auto";
+  QString outputFile;
+  bool runCase = false;
+
+  QStringList arguments = app.arguments();
+  for(int i = 1; i < arguments.size(); i++)
+  {
+    const QString& option = arguments[i];
+    if(option == "--help" || option == "-h")
+    {
+      PrintUsage();
+      return EXIT_SUCCESS;
+    }
+    if(option == "--run-case")
+    {
+      runCase = true;
+      continue;
+    }
+    if(i + 1 >= arguments.size())
+    {
+      std::cerr << "Missing value for option " << option.toStdString() << std::endl;
+      PrintUsage();
+      return EXIT_FAILURE;
+    }
+    const QString value = arguments[++i];
+    if(option == "--filters")
+    {
+      filters = SplitList(value);
+    }
+    else if(option == "--types")
+    {
+      types = SplitList(value);
+    }
+    else if(option == "--dimensions")
+    {
+      dimensions = SplitList(value);
+    }
+    else if(option == "--sizes")
+    {
+      sizes = SplitList(value);
+    }
+    else if(option == "--repetitions")
+    {
+      repetitions = std::max(1, value.toInt());
+    }
+    else if(option == "--threads")
+    {
+      threads = std::max(0, value.toInt());
+    }
+    else if(option == "--simd")
+    {
+      simdSets = SplitList(value);
+    }
+    else if(option == "--output")
+    {
+      outputFile = value;
+    }
+    else
+    {
+      std::cerr << "Unknown option " << option.toStdString() << std::endl;
+      PrintUsage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  if(runCase)
+  {
+    // Child process: exactly one case
+    if(filters.size() != 1 || types.size() != 1 || dimensions.size() != 1 || sizes.size() != 1)
+    {
+      std::cerr << "--run-case requires exactly one filter, type, dimension and size" << std::endl;
+      return EXIT_FAILURE;
+    }
+    return RunCase(filters[0], types[0], dimensions[0].toInt(), sizes[0].toInt(), threads, repetitions);
+  }
+
+  QFile file(outputFile);
+  QTextStream csv(&file);
+  if(!outputFile.isEmpty())
+  {
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+      std::cerr << "Could not open " << outputFile.toStdString() << " for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+    csv << ITKBenchmarkBase::CsvHeader() << "\n";
+  }
+  std::cout << ITKBenchmarkBase::CsvHeader().toStdString() << std::endl;
+
+  foreach(QString filterName, filters)
+  {
+    foreach(QString dimension, dimensions)
+    {
+      foreach(QString size, sizes)
+      {
+        foreach(QString type, types)
+        {
+          foreach(QString simd, simdSets)
+          {
+            QStringList caseArguments;
+            caseArguments << "--run-case"
+                          << "--filters" << filterName << "--types" << type << "--dimensions" << dimension << "--sizes" << size << "--repetitions" << QString::number(repetitions) << "--threads"
+                          << QString::number(threads);
+            QProcess process;
+            process.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+            QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+            environment.remove(ITKImageProcessingConstants::SIMDEnvironmentVariable);
+            if(simd != "auto")
+            {
+              environment.insert(ITKImageProcessingConstants::SIMDEnvironmentVariable, simd);
+            }
+            process.setProcessEnvironment(environment);
+            process.start(QCoreApplication::applicationFilePath(), caseArguments);
+            process.waitForFinished(-1);
+            // Plugins may print while loading: the result is the line starting with the filter name
+            QString line;
+            QStringList lines = QString::fromLocal8Bit(process.readAllStandardOutput()).split('\n', QString::SkipEmptyParts);
+            foreach(QString output, lines)
+            {
+              if(output.startsWith(filterName + ","))
+              {
+                line = output.trimmed();
+              }
+            }
+            if(process.exitStatus() != QProcess::NormalExit || line.isEmpty())
+            {
+              line = QString("%1,%2,%3,%4,,%5,%6,0,,,,,crashed").arg(filterName).arg(type).arg(dimension).arg(size).arg(threads).arg(simd);
+            }
+            std::cout << line.toStdString() << std::endl;
+            if(!outputFile.isEmpty())
+            {
+              csv << line << "\n";
+              csv.flush();
+            }
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKIntensityWindowingImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKIntensityWindowingImageBenchmark()
+  : ITKBenchmarkBase("ITKIntensityWindowingImage")
+  {
+  }
+  virtual ~ITKIntensityWindowingImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("WindowMinimum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255.0);
+      var.setValue(d3d_var);
+      filter->setProperty("WindowMaximum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMinimum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255.0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMaximum", var);
+    }
+  }
+
+private:
+  ITKIntensityWindowingImageBenchmark(const ITKIntensityWindowingImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKIntensityWindowingImageBenchmark&);                      // Operator '=' Not Implemented
+};
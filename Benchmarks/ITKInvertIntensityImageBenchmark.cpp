@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKInvertIntensityImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKInvertIntensityImageBenchmark()
+  : ITKBenchmarkBase("ITKInvertIntensityImage")
+  {
+  }
+  virtual ~ITKInvertIntensityImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255);
+      var.setValue(d3d_var);
+      filter->setProperty("Maximum", var);
+    }
+  }
+
+private:
+  ITKInvertIntensityImageBenchmark(const ITKInvertIntensityImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKInvertIntensityImageBenchmark&);                   // Operator '=' Not Implemented
+};
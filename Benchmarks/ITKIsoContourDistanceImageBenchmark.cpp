@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKIsoContourDistanceImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKIsoContourDistanceImageBenchmark()
+  : ITKBenchmarkBase("ITKIsoContourDistanceImage")
+  {
+  }
+  virtual ~ITKIsoContourDistanceImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("LevelSetValue", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(10);
+      var.setValue(d3d_var);
+      filter->setProperty("FarValue", var);
+    }
+  }
+
+private:
+  ITKIsoContourDistanceImageBenchmark(const ITKIsoContourDistanceImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKIsoContourDistanceImageBenchmark&);                      // Operator '=' Not Implemented
+};
@@ -0,0 +1,46 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKLabelContourImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKLabelContourImageBenchmark()
+  : ITKBenchmarkBase("ITKLabelContourImage")
+  {
+  }
+  virtual ~ITKLabelContourImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("BackgroundValue", var);
+    }
+  }
+
+private:
+  ITKLabelContourImageBenchmark(const ITKLabelContourImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKLabelContourImageBenchmark&);                // Operator '=' Not Implemented
+};
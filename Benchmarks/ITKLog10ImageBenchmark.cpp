@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKLog10ImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKLog10ImageBenchmark()
+  : ITKBenchmarkBase("ITKLog10Image")
+  {
+  }
+  virtual ~ITKLog10ImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKLog10ImageBenchmark(const ITKLog10ImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKLog10ImageBenchmark&);         // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKLogImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKLogImageBenchmark()
+  : ITKBenchmarkBase("ITKLogImage")
+  {
+  }
+  virtual ~ITKLogImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKLogImageBenchmark(const ITKLogImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKLogImageBenchmark&);       // Operator '=' Not Implemented
+};
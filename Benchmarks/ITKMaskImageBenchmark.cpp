@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKMaskImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKMaskImageBenchmark()
+  : ITKBenchmarkBase("ITKMaskImage")
+  {
+  }
+  virtual ~ITKMaskImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+  }
+
+private:
+  ITKMaskImageBenchmark(const ITKMaskImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKMaskImageBenchmark&);        // Operator '=' Not Implemented
+};
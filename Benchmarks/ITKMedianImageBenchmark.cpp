@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
+
+class ITKMedianImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKMedianImageBenchmark()
+  : ITKBenchmarkBase("ITKMedianImage")
+  {
+  }
+  virtual ~ITKMedianImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      FloatVec3_t d3d_var = CastStdToVec3<std::vector<unsigned int>, FloatVec3_t, float>(std::vector<unsigned int>(3, 1));
+      var.setValue(d3d_var);
+      filter->setProperty("Radius", var);
+    }
+  }
+
+private:
+  ITKMedianImageBenchmark(const ITKMedianImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKMedianImageBenchmark&);          // Operator '=' Not Implemented
+};
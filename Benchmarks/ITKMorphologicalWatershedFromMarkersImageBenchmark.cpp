@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+
+class ITKMorphologicalWatershedFromMarkersImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKMorphologicalWatershedFromMarkersImageBenchmark()
+  : ITKBenchmarkBase("ITKMorphologicalWatershedFromMarkersImage")
+  {
+  }
+  virtual ~ITKMorphologicalWatershedFromMarkersImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("MarkWatershedLine", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+  }
+
+private:
+  ITKMorphologicalWatershedFromMarkersImageBenchmark(const ITKMorphologicalWatershedFromMarkersImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKMorphologicalWatershedFromMarkersImageBenchmark&);                                     // Operator '=' Not Implemented
+};
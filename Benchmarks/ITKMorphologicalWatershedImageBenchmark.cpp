@@ -0,0 +1,51 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKMorphologicalWatershedImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKMorphologicalWatershedImageBenchmark()
+  : ITKBenchmarkBase("ITKMorphologicalWatershedImage")
+  {
+  }
+  virtual ~ITKMorphologicalWatershedImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Level", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("MarkWatershedLine", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+  }
+
+private:
+  ITKMorphologicalWatershedImageBenchmark(const ITKMorphologicalWatershedImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKMorphologicalWatershedImageBenchmark&);                          // Operator '=' Not Implemented
+};
@@ -0,0 +1,82 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKMultiScaleHessianBasedObjectnessImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKMultiScaleHessianBasedObjectnessImageBenchmark()
+  : ITKBenchmarkBase("ITKMultiScaleHessianBasedObjectnessImage")
+  {
+  }
+  virtual ~ITKMultiScaleHessianBasedObjectnessImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("ObjectDimension", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.5);
+      var.setValue(d3d_var);
+      filter->setProperty("Alpha", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.5);
+      var.setValue(d3d_var);
+      filter->setProperty("Beta", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(5.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Gamma", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("BrightObject", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("ScaleObjectnessMeasure", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.2);
+      var.setValue(d3d_var);
+      filter->setProperty("SigmaMinimum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(2.0);
+      var.setValue(d3d_var);
+      filter->setProperty("SigmaMaximum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(10);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfSigmaSteps", var);
+    }
+  }
+
+private:
+  ITKMultiScaleHessianBasedObjectnessImageBenchmark(const ITKMultiScaleHessianBasedObjectnessImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKMultiScaleHessianBasedObjectnessImageBenchmark&);                                    // Operator '=' Not Implemented
+};
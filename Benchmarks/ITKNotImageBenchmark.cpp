@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKNotImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKNotImageBenchmark()
+  : ITKBenchmarkBase("ITKNotImage")
+  {
+  }
+  virtual ~ITKNotImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKNotImageBenchmark(const ITKNotImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKNotImageBenchmark&);       // Operator '=' Not Implemented
+};
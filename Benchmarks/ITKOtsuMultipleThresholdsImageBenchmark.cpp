@@ -0,0 +1,57 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKOtsuMultipleThresholdsImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKOtsuMultipleThresholdsImageBenchmark()
+  : ITKBenchmarkBase("ITKOtsuMultipleThresholdsImage")
+  {
+  }
+  virtual ~ITKOtsuMultipleThresholdsImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfThresholds", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("LabelOffset", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(128u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfHistogramBins", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("ValleyEmphasis", var);
+    }
+  }
+
+private:
+  ITKOtsuMultipleThresholdsImageBenchmark(const ITKOtsuMultipleThresholdsImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKOtsuMultipleThresholdsImageBenchmark&);                          // Operator '=' Not Implemented
+};
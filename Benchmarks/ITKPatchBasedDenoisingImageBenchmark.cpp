@@ -0,0 +1,96 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKPatchBasedDenoisingImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKPatchBasedDenoisingImageBenchmark()
+  : ITKBenchmarkBase("ITKPatchBasedDenoisingImage")
+  {
+  }
+  virtual ~ITKPatchBasedDenoisingImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(400.0);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelBandwidthSigma", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(4u);
+      var.setValue(d3d_var);
+      filter->setProperty("PatchRadius", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfIterations", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(200u);
+      var.setValue(d3d_var);
+      filter->setProperty("NumberOfSamplePatches", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(400.0);
+      var.setValue(d3d_var);
+      filter->setProperty("SampleVariance", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("NoiseSigma", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("NoiseModelFidelityWeight", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("AlwaysTreatComponentsAsEuclidean", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelBandwidthEstimation", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelBandwidthMultiplicationFactor", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(3u);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelBandwidthUpdateFrequency", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.2);
+      var.setValue(d3d_var);
+      filter->setProperty("KernelBandwidthFractionPixelsForEstimation", var);
+    }
+  }
+
+private:
+  ITKPatchBasedDenoisingImageBenchmark(const ITKPatchBasedDenoisingImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKPatchBasedDenoisingImageBenchmark&);                       // Operator '=' Not Implemented
+};
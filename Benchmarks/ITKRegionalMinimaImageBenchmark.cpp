@@ -0,0 +1,56 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKRegionalMinimaImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKRegionalMinimaImageBenchmark()
+  : ITKBenchmarkBase("ITKRegionalMinimaImage")
+  {
+  }
+  virtual ~ITKRegionalMinimaImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("BackgroundValue", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("ForegroundValue", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(true);
+      var.setValue(d3d_var);
+      filter->setProperty("FlatIsMinima", var);
+    }
+  }
+
+private:
+  ITKRegionalMinimaImageBenchmark(const ITKRegionalMinimaImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKRegionalMinimaImageBenchmark&);                  // Operator '=' Not Implemented
+};
@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKRescaleIntensityImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKRescaleIntensityImageBenchmark()
+  : ITKBenchmarkBase("ITKRescaleIntensityImage")
+  {
+  }
+  virtual ~ITKRescaleIntensityImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMinimum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMaximum", var);
+    }
+  }
+
+private:
+  ITKRescaleIntensityImageBenchmark(const ITKRescaleIntensityImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKRescaleIntensityImageBenchmark&);                    // Operator '=' Not Implemented
+};
@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKShiftScaleImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKShiftScaleImageBenchmark()
+  : ITKBenchmarkBase("ITKShiftScaleImage")
+  {
+  }
+  virtual ~ITKShiftScaleImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("Shift", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Scale", var);
+    }
+  }
+
+private:
+  ITKShiftScaleImageBenchmark(const ITKShiftScaleImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKShiftScaleImageBenchmark&);              // Operator '=' Not Implemented
+};
@@ -0,0 +1,55 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKSigmoidImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSigmoidImageBenchmark()
+  : ITKBenchmarkBase("ITKSigmoidImage")
+  {
+  }
+  virtual ~ITKSigmoidImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1);
+      var.setValue(d3d_var);
+      filter->setProperty("Alpha", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("Beta", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMaximum", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMinimum", var);
+    }
+  }
+
+private:
+  ITKSigmoidImageBenchmark(const ITKSigmoidImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSigmoidImageBenchmark&);           // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKSinImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSinImageBenchmark()
+  : ITKBenchmarkBase("ITKSinImage")
+  {
+  }
+  virtual ~ITKSinImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKSinImageBenchmark(const ITKSinImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSinImageBenchmark&);       // Operator '=' Not Implemented
+};
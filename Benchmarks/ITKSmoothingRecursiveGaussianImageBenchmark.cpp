@@ -0,0 +1,46 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKSmoothingRecursiveGaussianImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSmoothingRecursiveGaussianImageBenchmark()
+  : ITKBenchmarkBase("ITKSmoothingRecursiveGaussianImage")
+  {
+  }
+  virtual ~ITKSmoothingRecursiveGaussianImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Sigma", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("NormalizeAcrossScale", var);
+    }
+  }
+
+private:
+  ITKSmoothingRecursiveGaussianImageBenchmark(const ITKSmoothingRecursiveGaussianImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSmoothingRecursiveGaussianImageBenchmark&);                              // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKSobelEdgeDetectionImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSobelEdgeDetectionImageBenchmark()
+  : ITKBenchmarkBase("ITKSobelEdgeDetectionImage")
+  {
+  }
+  virtual ~ITKSobelEdgeDetectionImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKSobelEdgeDetectionImageBenchmark(const ITKSobelEdgeDetectionImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSobelEdgeDetectionImageBenchmark&);                      // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKSqrtImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSqrtImageBenchmark()
+  : ITKBenchmarkBase("ITKSqrtImage")
+  {
+  }
+  virtual ~ITKSqrtImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKSqrtImageBenchmark(const ITKSqrtImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSqrtImageBenchmark&);        // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKSquareImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSquareImageBenchmark()
+  : ITKBenchmarkBase("ITKSquareImage")
+  {
+  }
+  virtual ~ITKSquareImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKSquareImageBenchmark(const ITKSquareImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSquareImageBenchmark&);          // Operator '=' Not Implemented
+};
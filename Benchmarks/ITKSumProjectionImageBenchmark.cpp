@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKSumProjectionImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKSumProjectionImageBenchmark()
+  : ITKBenchmarkBase("ITKSumProjectionImage")
+  {
+  }
+  virtual ~ITKSumProjectionImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("ProjectionDimension", var);
+    }
+  }
+
+private:
+  ITKSumProjectionImageBenchmark(const ITKSumProjectionImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKSumProjectionImageBenchmark&);                 // Operator '=' Not Implemented
+};
@@ -0,0 +1,34 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+
+class ITKTanImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKTanImageBenchmark()
+  : ITKBenchmarkBase("ITKTanImage")
+  {
+  }
+  virtual ~ITKTanImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+  }
+
+private:
+  ITKTanImageBenchmark(const ITKTanImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKTanImageBenchmark&);       // Operator '=' Not Implemented
+};
@@ -0,0 +1,50 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKThresholdImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKThresholdImageBenchmark()
+  : ITKBenchmarkBase("ITKThresholdImage")
+  {
+  }
+  virtual ~ITKThresholdImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Lower", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("Upper", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0.0);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+  }
+
+private:
+  ITKThresholdImageBenchmark(const ITKThresholdImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKThresholdImageBenchmark&);             // Operator '=' Not Implemented
+};
@@ -0,0 +1,56 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKThresholdMaximumConnectedComponentsImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKThresholdMaximumConnectedComponentsImageBenchmark()
+  : ITKBenchmarkBase("ITKThresholdMaximumConnectedComponentsImage")
+  {
+  }
+  virtual ~ITKThresholdMaximumConnectedComponentsImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("MinimumObjectSizeInPixels", var);
+    }
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(std::numeric_limits<double>::max());
+      var.setValue(d3d_var);
+      filter->setProperty("UpperBoundary", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("InsideValue", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("OutsideValue", var);
+    }
+  }
+
+private:
+  ITKThresholdMaximumConnectedComponentsImageBenchmark(const ITKThresholdMaximumConnectedComponentsImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKThresholdMaximumConnectedComponentsImageBenchmark&);                                       // Operator '=' Not Implemented
+};
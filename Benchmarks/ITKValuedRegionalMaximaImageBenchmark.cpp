@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+
+class ITKValuedRegionalMaximaImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKValuedRegionalMaximaImageBenchmark()
+  : ITKBenchmarkBase("ITKValuedRegionalMaximaImage")
+  {
+  }
+  virtual ~ITKValuedRegionalMaximaImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+  }
+
+private:
+  ITKValuedRegionalMaximaImageBenchmark(const ITKValuedRegionalMaximaImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKValuedRegionalMaximaImageBenchmark&);                        // Operator '=' Not Implemented
+};
@@ -0,0 +1,46 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKVectorConnectedComponentImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKVectorConnectedComponentImageBenchmark()
+  : ITKBenchmarkBase("ITKVectorConnectedComponentImage")
+  {
+  }
+  virtual ~ITKVectorConnectedComponentImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(1.0);
+      var.setValue(d3d_var);
+      filter->setProperty("DistanceThreshold", var);
+    }
+    {
+      bool d3d_var = StaticCastScalar<bool, bool, bool>(false);
+      var.setValue(d3d_var);
+      filter->setProperty("FullyConnected", var);
+    }
+  }
+
+private:
+  ITKVectorConnectedComponentImageBenchmark(const ITKVectorConnectedComponentImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKVectorConnectedComponentImageBenchmark&);                            // Operator '=' Not Implemented
+};
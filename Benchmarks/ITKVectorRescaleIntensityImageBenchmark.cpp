@@ -0,0 +1,40 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+
+class ITKVectorRescaleIntensityImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKVectorRescaleIntensityImageBenchmark()
+  : ITKBenchmarkBase("ITKVectorRescaleIntensityImage")
+  {
+  }
+  virtual ~ITKVectorRescaleIntensityImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      double d3d_var = StaticCastScalar<double, double, double>(255);
+      var.setValue(d3d_var);
+      filter->setProperty("OutputMaximumMagnitude", var);
+    }
+  }
+
+private:
+  ITKVectorRescaleIntensityImageBenchmark(const ITKVectorRescaleIntensityImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKVectorRescaleIntensityImageBenchmark&);                          // Operator '=' Not Implemented
+};
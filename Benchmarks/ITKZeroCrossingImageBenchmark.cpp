@@ -0,0 +1,45 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
+
+class ITKZeroCrossingImageBenchmark : public ITKBenchmarkBase
+{
+
+public:
+  ITKZeroCrossingImageBenchmark()
+  : ITKBenchmarkBase("ITKZeroCrossingImage")
+  {
+  }
+  virtual ~ITKZeroCrossingImageBenchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(1u);
+      var.setValue(d3d_var);
+      filter->setProperty("ForegroundValue", var);
+    }
+    {
+      int d3d_var = StaticCastScalar<int, int, int>(0u);
+      var.setValue(d3d_var);
+      filter->setProperty("BackgroundValue", var);
+    }
+  }
+
+private:
+  ITKZeroCrossingImageBenchmark(const ITKZeroCrossingImageBenchmark&); // Copy Constructor Not Implemented
+  void operator=(const ITKZeroCrossingImageBenchmark&);                // Operator '=' Not Implemented
+};
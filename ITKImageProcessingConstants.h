@@ -49,6 +49,20 @@ namespace FilterGroups
 const QString ITKImageProcessingFilters("ITKImageProcessing");
 }
 
+// Keys of the plugin settings
+namespace Settings
+{
+const QString MaximumNumberOfThreads("ITKMaximumNumberOfThreads");
+const QString UseThreadPool("ITKUseThreadPool");
+const QString TraceFile("ITKTraceFile");
+}
+
+// Environment variable enabling the performance trace of the ITK filters
+const QString TraceFileEnvironmentVariable("ITKIMAGEPROCESSING_TRACE_FILE");
+
+// Environment variable selecting the SIMD instruction set of the unary math kernels ("off" disables them)
+const QString SIMDEnvironmentVariable("ITKIMAGEPROCESSING_SIMD");
+
 // define pixels for dream3d variable types
 typedef int8_t Int8PixelType;
 typedef uint8_t UInt8PixelType;
@@ -145,6 +145,14 @@
 #define Q(x) #x
 #define QUOTE(x) Q(x)
 
+// Returns true if the 2D version of the filter is run, which is the case if the image has a
+// single slice. ITKImageBase provides an overload that also selects it to process the slices
+// of a 3D image independently (see ITKImageBase::getSliceBySlice()).
+inline bool Dream3DUse2DImage(const AbstractFilter*, const QVector<size_t>& tDims)
+{
+  return tDims[2] == 1;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //                          Common to scalar, Vector and RGB/RGBA               //
 //////////////////////////////////////////////////////////////////////////////
@@ -170,7 +178,7 @@
 #define Dream3DTemplateAliasMacroCase_1(typeIN, typeOUT, call, var_type, tDims, errorCondition, quotedType, isTypeOUT, typeOUTTypename)                                                                \
   if(var_type.compare(quotedType) == 0)                                                                                                                                                                \
   {                                                                                                                                                                                                    \
-    if(tDims[2] == 1)                                                                                                                                                                                  \
+    if(Dream3DUse2DImage(this, tDims))                                                                                                                                                                 \
     {                                                                                                                                                                                                  \
       /* 2D image */                                                                                                                                                                                   \
       Dream3DTemplateAliasMacroPixelType(typeIN, typeOUT, call, errorCondition, isTypeOUT, typeOUTTypename, 2)                                                                                         \
@@ -43,6 +43,7 @@ void ITKAbsImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKAbsImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -64,6 +65,7 @@ void ITKAbsImage::readFilterParameters(AbstractFilterParametersReader* reader, i
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -99,7 +101,7 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   // define filter
   typedef itk::AbsImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
-  this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageBase::filterUnaryMath<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, ITKDream3DHelper::UnaryMathOperation::Abs);
 }
 
 // -----------------------------------------------------------------------------
@@ -15,6 +15,19 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#ifdef ITKImageProcessing_SIMPLEITK_PIXEL_TYPES
+#define DREAM3D_USE_int8_t 1
+#define DREAM3D_USE_uint8_t 1
+#define DREAM3D_USE_int16_t 1
+#define DREAM3D_USE_uint16_t 1
+#define DREAM3D_USE_int32_t 1
+#define DREAM3D_USE_uint32_t 1
+#define DREAM3D_USE_int64_t 1
+#define DREAM3D_USE_uint64_t 1
+#define DREAM3D_USE_float 0
+#define DREAM3D_USE_double 0
+#endif
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/Dream3DTemplateAliasMacro.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 
@@ -48,6 +61,7 @@ void ITKApproximateSignedDistanceMapImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKApproximateSignedDistanceMapImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -69,6 +83,7 @@ void ITKApproximateSignedDistanceMapImage::readFilterParameters(AbstractFilterPa
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
   setOutsideValue(reader->readValue("OutsideValue", getOutsideValue()));
 
@@ -155,3 +170,12 @@ const QString ITKApproximateSignedDistanceMapImage::getSubGroupName() const
 {
   return "ITK DistanceMap";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKApproximateSignedDistanceMapImage::isStreamable() const
+{
+  // The distance is propagated across the whole image
+  return false;
+}
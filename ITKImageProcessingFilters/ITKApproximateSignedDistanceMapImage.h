@@ -95,6 +95,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKApproximateSignedDistanceMapImage(const ITKApproximateSignedDistanceMapImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKApproximateSignedDistanceMapImage&);                       // Operator '=' Not Implemented
@@ -17,6 +17,19 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#ifdef ITKImageProcessing_SIMPLEITK_PIXEL_TYPES
+#define DREAM3D_USE_int8_t 1
+#define DREAM3D_USE_uint8_t 1
+#define DREAM3D_USE_int16_t 1
+#define DREAM3D_USE_uint16_t 1
+#define DREAM3D_USE_int32_t 1
+#define DREAM3D_USE_uint32_t 1
+#define DREAM3D_USE_int64_t 1
+#define DREAM3D_USE_uint64_t 1
+#define DREAM3D_USE_float 0
+#define DREAM3D_USE_double 0
+#endif
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/Dream3DTemplateAliasMacro.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 #include <itkFlatStructuringElement.h>
@@ -72,6 +85,7 @@ void ITKBinaryClosingByReconstructionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryClosingByReconstructionImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -93,6 +107,7 @@ void ITKBinaryClosingByReconstructionImage::readFilterParameters(AbstractFilterP
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setForegroundValue(reader->readValue("ForegroundValue", getForegroundValue()));
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
   setKernelRadius(reader->readFloatVec3("KernelRadius", getKernelRadius()));
@@ -215,3 +230,12 @@ const QString ITKBinaryClosingByReconstructionImage::getSubGroupName() const
 {
   return "ITK BinaryMathematicalMorphology";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKBinaryClosingByReconstructionImage::isStreamable() const
+{
+  // The morphological reconstruction is propagated across the whole image
+  return false;
+}
@@ -104,6 +104,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKBinaryClosingByReconstructionImage(const ITKBinaryClosingByReconstructionImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKBinaryClosingByReconstructionImage&);                        // Operator '=' Not Implemented
@@ -17,6 +17,19 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#ifdef ITKImageProcessing_SIMPLEITK_PIXEL_TYPES
+#define DREAM3D_USE_int8_t 1
+#define DREAM3D_USE_uint8_t 1
+#define DREAM3D_USE_int16_t 1
+#define DREAM3D_USE_uint16_t 1
+#define DREAM3D_USE_int32_t 1
+#define DREAM3D_USE_uint32_t 1
+#define DREAM3D_USE_int64_t 1
+#define DREAM3D_USE_uint64_t 1
+#define DREAM3D_USE_float 0
+#define DREAM3D_USE_double 0
+#endif
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/Dream3DTemplateAliasMacro.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 #include <itkFlatStructuringElement.h>
@@ -74,6 +87,7 @@ void ITKBinaryErodeImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryErodeImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -95,6 +109,7 @@ void ITKBinaryErodeImage::readFilterParameters(AbstractFilterParametersReader* r
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setBackgroundValue(reader->readValue("BackgroundValue", getBackgroundValue()));
   setForegroundValue(reader->readValue("ForegroundValue", getForegroundValue()));
   setBoundaryToForeground(reader->readValue("BoundaryToForeground", getBoundaryToForeground()));
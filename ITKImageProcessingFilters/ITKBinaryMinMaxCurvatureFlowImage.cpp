@@ -15,6 +15,19 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#ifdef ITKImageProcessing_SIMPLEITK_PIXEL_TYPES
+#define DREAM3D_USE_int8_t 0
+#define DREAM3D_USE_uint8_t 0
+#define DREAM3D_USE_int16_t 0
+#define DREAM3D_USE_uint16_t 0
+#define DREAM3D_USE_int32_t 0
+#define DREAM3D_USE_uint32_t 0
+#define DREAM3D_USE_int64_t 0
+#define DREAM3D_USE_uint64_t 0
+#define DREAM3D_USE_float 1
+#define DREAM3D_USE_double 1
+#endif
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/Dream3DTemplateAliasMacro.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 
@@ -52,6 +65,7 @@ void ITKBinaryMinMaxCurvatureFlowImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryMinMaxCurvatureFlowImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +87,7 @@ void ITKBinaryMinMaxCurvatureFlowImage::readFilterParameters(AbstractFilterParam
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
   setStencilRadius(reader->readValue("StencilRadius", getStencilRadius()));
@@ -164,3 +179,12 @@ const QString ITKBinaryMinMaxCurvatureFlowImage::getSubGroupName() const
 {
   return "ITK SegmentationPostProcessing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKBinaryMinMaxCurvatureFlowImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
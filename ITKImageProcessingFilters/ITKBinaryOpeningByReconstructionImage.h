@@ -107,6 +107,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKBinaryOpeningByReconstructionImage(const ITKBinaryOpeningByReconstructionImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKBinaryOpeningByReconstructionImage&);                        // Operator '=' Not Implemented
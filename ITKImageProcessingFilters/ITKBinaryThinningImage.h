@@ -88,6 +88,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKBinaryThinningImage(const ITKBinaryThinningImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKBinaryThinningImage&);         // Operator '=' Not Implemented
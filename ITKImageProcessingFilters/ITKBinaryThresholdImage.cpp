@@ -52,6 +52,7 @@ void ITKBinaryThresholdImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryThresholdImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKBinaryThresholdImage::readFilterParameters(AbstractFilterParametersReade
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setLowerThreshold(reader->readValue("LowerThreshold", getLowerThreshold()));
   setUpperThreshold(reader->readValue("UpperThreshold", getUpperThreshold()));
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
@@ -72,6 +72,7 @@ void ITKClosingByReconstructionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKClosingByReconstructionImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -93,6 +94,7 @@ void ITKClosingByReconstructionImage::readFilterParameters(AbstractFilterParamet
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
   setPreserveIntensities(reader->readValue("PreserveIntensities", getPreserveIntensities()));
   setKernelRadius(reader->readFloatVec3("KernelRadius", getKernelRadius()));
@@ -205,3 +207,12 @@ const QString ITKClosingByReconstructionImage::getSubGroupName() const
 {
   return "ITK MathematicalMorphology";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKClosingByReconstructionImage::isStreamable() const
+{
+  // The morphological reconstruction is propagated across the whole image
+  return false;
+}
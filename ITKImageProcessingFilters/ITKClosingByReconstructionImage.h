@@ -103,6 +103,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKClosingByReconstructionImage(const ITKClosingByReconstructionImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKClosingByReconstructionImage&);                  // Operator '=' Not Implemented
@@ -95,6 +95,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKConnectedComponentImage(const ITKConnectedComponentImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKConnectedComponentImage&);             // Operator '=' Not Implemented
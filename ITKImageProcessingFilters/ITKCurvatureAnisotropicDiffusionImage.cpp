@@ -52,6 +52,7 @@ void ITKCurvatureAnisotropicDiffusionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKCurvatureAnisotropicDiffusionImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKCurvatureAnisotropicDiffusionImage::readFilterParameters(AbstractFilterP
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setConductanceParameter(reader->readValue("ConductanceParameter", getConductanceParameter()));
   setConductanceScalingUpdateInterval(reader->readValue("ConductanceScalingUpdateInterval", getConductanceScalingUpdateInterval()));
@@ -166,3 +168,20 @@ const QString ITKCurvatureAnisotropicDiffusionImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureAnisotropicDiffusionImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKCurvatureAnisotropicDiffusionImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
@@ -48,6 +48,7 @@ void ITKCurvatureFlowImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKCurvatureFlowImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -69,6 +70,7 @@ void ITKCurvatureFlowImage::readFilterParameters(AbstractFilterParametersReader*
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
 
@@ -157,3 +159,20 @@ const QString ITKCurvatureFlowImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureFlowImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKCurvatureFlowImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
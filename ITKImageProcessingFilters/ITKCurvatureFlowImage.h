@@ -95,6 +95,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief getInternalBufferFactor Reimplemented from @see ITKImageBase class
+   */
+  virtual double getInternalBufferFactor() const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKCurvatureFlowImage(const ITKCurvatureFlowImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKCurvatureFlowImage&);        // Operator '=' Not Implemented
@@ -52,6 +52,7 @@ void ITKDiscreteGaussianImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKDiscreteGaussianImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKDiscreteGaussianImage::readFilterParameters(AbstractFilterParametersRead
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setVariance(reader->readValue("Variance", getVariance()));
   setMaximumKernelWidth(reader->readValue("MaximumKernelWidth", getMaximumKernelWidth()));
   setMaximumError(reader->readValue("MaximumError", getMaximumError()));
@@ -164,3 +166,11 @@ const QString ITKDiscreteGaussianImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKDiscreteGaussianImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
@@ -102,6 +102,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief getInternalBufferFactor Reimplemented from @see ITKImageBase class
+   */
+  virtual double getInternalBufferFactor() const override;
+
 private:
   ITKDiscreteGaussianImage(const ITKDiscreteGaussianImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKDiscreteGaussianImage&);           // Operator '=' Not Implemented
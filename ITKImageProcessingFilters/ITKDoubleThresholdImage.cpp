@@ -58,6 +58,7 @@ void ITKDoubleThresholdImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKDoubleThresholdImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -79,6 +80,7 @@ void ITKDoubleThresholdImage::readFilterParameters(AbstractFilterParametersReade
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setThreshold1(reader->readValue("Threshold1", getThreshold1()));
   setThreshold2(reader->readValue("Threshold2", getThreshold2()));
   setThreshold3(reader->readValue("Threshold3", getThreshold3()));
@@ -177,3 +179,12 @@ const QString ITKDoubleThresholdImage::getSubGroupName() const
 {
   return "ITK Thresholding";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKDoubleThresholdImage::isStreamable() const
+{
+  // The morphological reconstruction is propagated across the whole image
+  return false;
+}
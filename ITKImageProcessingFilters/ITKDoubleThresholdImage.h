@@ -112,6 +112,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKDoubleThresholdImage(const ITKDoubleThresholdImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKDoubleThresholdImage&);          // Operator '=' Not Implemented
@@ -72,6 +72,7 @@ void ITKErodeObjectMorphologyImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKErodeObjectMorphologyImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -93,6 +94,7 @@ void ITKErodeObjectMorphologyImage::readFilterParameters(AbstractFilterParameter
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setObjectValue(reader->readValue("ObjectValue", getObjectValue()));
   setBackgroundValue(reader->readValue("BackgroundValue", getBackgroundValue()));
   setKernelRadius(reader->readFloatVec3("KernelRadius", getKernelRadius()));
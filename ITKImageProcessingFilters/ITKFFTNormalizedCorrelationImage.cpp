@@ -49,6 +49,7 @@ void ITKFFTNormalizedCorrelationImage::setupFilterParameters()
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +73,7 @@ void ITKFFTNormalizedCorrelationImage::readFilterParameters(AbstractFilterParame
   setSelectedCellArrayPath(reader->readDataArrayPath("MovingCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setRequiredNumberOfOverlappingPixels(reader->readValue("RequiredNumberOfOverlappingPixels", getRequiredNumberOfOverlappingPixels()));
   setRequiredFractionOfOverlappingPixels(reader->readValue("RequiredFractionOfOverlappingPixels", getRequiredFractionOfOverlappingPixels()));
 
@@ -127,8 +129,13 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   toITKMoving->SetInPlace(true);
   toITKMoving->SetAttributeMatrixArrayName(getMovingCellArrayPath().getAttributeMatrixName().toStdString());
   toITKMoving->SetDataArrayName(getMovingCellArrayPath().getDataArrayName().toStdString());
+  applyNumberOfThreads(toITKMoving);
   filter->SetMovingImage(toITKMoving->GetOutput());
 
+  itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+  interruption->SetFilter(this);
+  itk::Size<Dimension> imageSize;
+  imageSize.Fill(0);
   try
   {
     DataArrayPath dap = getSelectedCellArrayPath();
@@ -140,22 +147,26 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
     toITK->SetInPlace(true);
     toITK->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
     toITK->SetDataArrayName(getSelectedCellArrayPath().getDataArrayName().toStdString());
-
-    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
-    interruption->SetFilter(this);
+    applyNumberOfThreads(toITK);
+    interruption->AddStage(toITK, "Bridge in");
+    interruption->AddStage(toITKMoving, "Bridge in");
 
     // Set up filter
     filter->SetFixedImage(toITK->GetOutput());
-    filter->AddObserver(itk::ProgressEvent(), interruption);
+    interruption->AddStage(filter, "Filter");
+    applyNumberOfThreads(filter);
 
     typedef itk::CastImageFilter<IntermediateImageType, OutputImageType> CasterType;
     typename CasterType::Pointer caster = CasterType::New();
     caster->SetInput(filter->GetOutput());
+    applyNumberOfThreads(caster);
+    interruption->AddStage(caster, "Cast");
     caster->Update();
 
     typename OutputImageType::Pointer image = OutputImageType::New();
     image = caster->GetOutput();
     image->DisconnectPipeline();
+    imageSize = image->GetLargestPossibleRegion().GetSize();
     std::string outputArrayName(getNewCellArrayName().toStdString());
 
     typedef itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension> toDream3DType;
@@ -165,6 +176,8 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
     toDream3DFilter->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
     toDream3DFilter->SetDataArrayName(outputArrayName);
     toDream3DFilter->SetDataContainer(dc);
+    applyNumberOfThreads(toDream3DFilter);
+    interruption->AddStage(toDream3DFilter, "Bridge out");
     toDream3DFilter->Update();
   } catch(itk::ExceptionObject& err)
   {
@@ -174,6 +187,8 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
     return;
   }
 
+  notifyExecutionStatistics(interruption, imageSize.CalculateProductOfElements());
+  writeTraceRecord<InputPixelType, OutputPixelType, Dimension>(interruption, imageSize);
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
@@ -221,3 +236,29 @@ const QString ITKFFTNormalizedCorrelationImage::getSubGroupName() const
 {
   return "ITK Registration";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKFFTNormalizedCorrelationImage::getInternalBufferFactor() const
+{
+  return 12.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFFTNormalizedCorrelationImage::isStreamable() const
+{
+  // The Fourier transforms need the whole image
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFFTNormalizedCorrelationImage::canProcessSlicesIndependently() const
+{
+  // The second input image is not split into slices
+  return false;
+}
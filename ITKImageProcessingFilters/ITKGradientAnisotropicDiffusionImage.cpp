@@ -52,6 +52,7 @@ void ITKGradientAnisotropicDiffusionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKGradientAnisotropicDiffusionImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKGradientAnisotropicDiffusionImage::readFilterParameters(AbstractFilterPa
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setConductanceParameter(reader->readValue("ConductanceParameter", getConductanceParameter()));
   setConductanceScalingUpdateInterval(reader->readValue("ConductanceScalingUpdateInterval", getConductanceScalingUpdateInterval()));
@@ -166,3 +168,20 @@ const QString ITKGradientAnisotropicDiffusionImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKGradientAnisotropicDiffusionImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKGradientAnisotropicDiffusionImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
@@ -48,6 +48,7 @@ void ITKGradientMagnitudeRecursiveGaussianImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKGradientMagnitudeRecursiveGaussianImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -69,6 +70,7 @@ void ITKGradientMagnitudeRecursiveGaussianImage::readFilterParameters(AbstractFi
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setSigma(reader->readValue("Sigma", getSigma()));
   setNormalizeAcrossScale(reader->readValue("NormalizeAcrossScale", getNormalizeAcrossScale()));
 
@@ -155,3 +157,20 @@ const QString ITKGradientMagnitudeRecursiveGaussianImage::getSubGroupName() cons
 {
   return "ITK Edge";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKGradientMagnitudeRecursiveGaussianImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKGradientMagnitudeRecursiveGaussianImage::isStreamable() const
+{
+  // Recursive Gaussian filters run along whole image lines in every direction
+  return false;
+}
@@ -46,6 +46,7 @@ void ITKGrayscaleFillholeImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKGrayscaleFillholeImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -67,6 +68,7 @@ void ITKGrayscaleFillholeImage::readFilterParameters(AbstractFilterParametersRea
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
 
   reader->closeFilterGroup();
@@ -151,3 +153,12 @@ const QString ITKGrayscaleFillholeImage::getSubGroupName() const
 {
   return "ITK MathematicalMorphology";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKGrayscaleFillholeImage::isStreamable() const
+{
+  // The morphological reconstruction is propagated across the whole image
+  return false;
+}
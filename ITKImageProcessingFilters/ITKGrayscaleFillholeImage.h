@@ -92,6 +92,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKGrayscaleFillholeImage(const ITKGrayscaleFillholeImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKGrayscaleFillholeImage&);            // Operator '=' Not Implemented
@@ -96,6 +96,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKHConvexImage(const ITKHConvexImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKHConvexImage&);  // Operator '=' Not Implemented
@@ -92,6 +92,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKHMaximaImage(const ITKHMaximaImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKHMaximaImage&);  // Operator '=' Not Implemented
@@ -96,6 +96,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKHMinimaImage(const ITKHMinimaImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKHMinimaImage&);  // Operator '=' Not Implemented
@@ -48,6 +48,7 @@ void ITKHistogramMatchingImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKHistogramMatchingImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize,
@@ -73,6 +74,7 @@ void ITKHistogramMatchingImage::readFilterParameters(AbstractFilterParametersRea
   setReferenceCellArrayPath(reader->readDataArrayPath("ReferenceCellArrayPath", getReferenceCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setNumberOfHistogramLevels(reader->readValue("NumberOfHistogramLevels", getNumberOfHistogramLevels()));
   setNumberOfMatchPoints(reader->readValue("NumberOfMatchPoints", getNumberOfMatchPoints()));
   setThresholdAtMeanIntensity(reader->readValue("ThresholdAtMeanIntensity", getThresholdAtMeanIntensity()));
@@ -234,6 +236,7 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   toITK->SetInPlace(true);
   toITK->SetAttributeMatrixArrayName(getReferenceCellArrayPath().getAttributeMatrixName().toStdString());
   toITK->SetDataArrayName(getReferenceCellArrayPath().getDataArrayName().toStdString());
+  applyNumberOfThreads(toITK);
   filter->SetReferenceImage(toITK->GetOutput());
   // Run filter
   this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
@@ -283,3 +286,21 @@ const QString ITKHistogramMatchingImage::getSubGroupName() const
 {
   return "ITK IntensityTransformation";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKHistogramMatchingImage::canProcessSlicesIndependently() const
+{
+  // The second input image is not split into slices
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKHistogramMatchingImage::isStreamable() const
+{
+  // The intensity statistics are computed on the whole image
+  return false;
+}
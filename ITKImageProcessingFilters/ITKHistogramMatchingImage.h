@@ -95,6 +95,11 @@ protected:
   */
   void virtual filterInternal() override;
 
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
   /**
   * @brief Applies the filter
   */
@@ -121,6 +126,11 @@ protected:
    */
   void CompareImagePixelTypes(const DataArrayPath& path1, const DataArrayPath& path2);
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKHistogramMatchingImage(const ITKHistogramMatchingImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKHistogramMatchingImage&);            // Operator '=' Not Implemented
@@ -4,11 +4,189 @@
 
 #include "ITKImageBase.h"
 
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <itkMultiThreader.h>
+
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Returns the peak resident set size of the process in bytes, or 0 if it is not available.
+ */
+size_t getPeakResidentSetSize()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return static_cast<size_t>(counters.PeakWorkingSetSize);
+  }
+  return 0;
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return static_cast<size_t>(usage.ru_maxrss); // bytes
+#else
+  return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
+}
+
+/**
+ * @brief Work shared by the threads running a unary math kernel: the buffer is processed in
+ * chunks that the threads take in turn.
+ */
+template <typename T> struct UnaryMathKernelData
+{
+  AbstractFilter* filter;
+  ITKDream3DHelper::UnaryMathOperation operation;
+  ITKDream3DHelper::SIMDInstructionSet instructionSet;
+  const T* input;
+  T* output;
+  size_t count;
+  size_t chunkSize;
+  std::atomic<size_t> nextChunk;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> ITK_THREAD_RETURN_TYPE UnaryMathKernelThreaderCallback(void* arg)
+{
+  typedef itk::MultiThreader::ThreadInfoStruct ThreadInfoType;
+  ThreadInfoType* info = static_cast<ThreadInfoType*>(arg);
+  UnaryMathKernelData<T>* data = static_cast<UnaryMathKernelData<T>*>(info->UserData);
+  for(size_t chunk = data->nextChunk++; chunk * data->chunkSize < data->count; chunk = data->nextChunk++)
+  {
+    if(data->filter->getCancel())
+    {
+      break;
+    }
+    const size_t begin = chunk * data->chunkSize;
+    const size_t count = std::min(data->chunkSize, data->count - begin);
+    ITKDream3DHelper::ApplyUnaryMath(data->operation, data->instructionSet, data->input + begin, data->output + begin, count);
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void RunUnaryMathKernel(AbstractFilter* filter, int numberOfThreads, ITKDream3DHelper::UnaryMathOperation operation, ITKDream3DHelper::SIMDInstructionSet instructionSet, const T* input,
+                        T* output, size_t count)
+{
+  UnaryMathKernelData<T> data;
+  data.filter = filter;
+  data.operation = operation;
+  data.instructionSet = instructionSet;
+  data.input = input;
+  data.output = output;
+  data.count = count;
+  // Large enough to amortize the scheduling, small enough to balance the threads and check for cancellation
+  data.chunkSize = 1 << 16;
+  data.nextChunk = 0;
+  const size_t numberOfChunks = (count + data.chunkSize - 1) / data.chunkSize;
+
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  threader->SetNumberOfThreads(static_cast<itk::ThreadIdType>(std::max<size_t>(1, std::min<size_t>(numberOfThreads, numberOfChunks))));
+  threader->SetSingleMethod(UnaryMathKernelThreaderCallback<T>, &data);
+  threader->SingleMethodExecute();
+}
+
+/**
+ * @brief Slices shared by the threads filtering a 3D image slice by slice: each thread takes the next
+ * slice to process and runs its own job on it.
+ */
+struct SliceJobsData
+{
+  AbstractFilter* filter;
+  const std::vector<std::function<void(size_t)>>* jobs;
+  size_t numberOfSlices;
+  std::atomic<size_t> nextSlice;
+  std::atomic<size_t> processedSlices;
+  std::atomic<bool> failed;
+  QMutex mutex;
+  QString errorMessage;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITK_THREAD_RETURN_TYPE SliceJobsThreaderCallback(void* arg)
+{
+  typedef itk::MultiThreader::ThreadInfoStruct ThreadInfoType;
+  ThreadInfoType* info = static_cast<ThreadInfoType*>(arg);
+  SliceJobsData* data = static_cast<SliceJobsData*>(info->UserData);
+  const std::function<void(size_t)>& job = (*data->jobs)[info->ThreadID];
+  for(size_t slice = data->nextSlice++; slice < data->numberOfSlices; slice = data->nextSlice++)
+  {
+    if(data->failed || data->filter->getCancel())
+    {
+      break;
+    }
+    try
+    {
+      job(slice);
+    } catch(itk::ExceptionObject& err)
+    {
+      QMutexLocker locker(&data->mutex);
+      if(!data->failed)
+      {
+        data->errorMessage = QString("slice %1: %2").arg(slice).arg(err.GetDescription());
+        data->failed = true;
+      }
+      break;
+    }
+    const size_t processedSlices = ++data->processedSlices;
+    // Like the ITK filters, only report the progress from the calling thread
+    if(info->ThreadID == 0)
+    {
+      QString message = QString("Slice %1 of %2").arg(processedSlices).arg(data->numberOfSlices);
+      data->filter->notifyProgressMessage(data->filter->getMessagePrefix(), data->filter->getHumanLabel(), message, static_cast<int>(processedSlices * 100 / data->numberOfSlices));
+    }
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -17,7 +195,16 @@ ITKImageBase::ITKImageBase()
 , m_SelectedCellArrayPath("", "", "")
 , m_NewCellArrayName("")
 , m_SaveAsNewArray(true)
+, m_NumberOfStreamDivisions(1)
+, m_NumberOfThreads(0)
+, m_MemoryBudget(0)
+, m_SliceBySlice(false)
 , m_NewCellArray(nullptr)
+, m_StreamDivisions(1)
+, m_Threads(0)
+, m_EstimatedPeakMemory(0.0)
+, m_InputBuffer(nullptr)
+, m_CollectingSliceJobs(false)
 {
   initialize();
 }
@@ -37,6 +224,386 @@ void ITKImageBase::initialize()
   setCancel(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::setupExecutionFilterParameters(FilterParameterVector& parameters)
+{
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number Of Stream Divisions", NumberOfStreamDivisions, FilterParameter::Parameter, ITKImageBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number Of Threads", NumberOfThreads, FilterParameter::Parameter, ITKImageBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Memory Budget (MB)", MemoryBudget, FilterParameter::Parameter, ITKImageBase));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Process Slices Independently", SliceBySlice, FilterParameter::Parameter, ITKImageBase));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::readExecutionFilterParameters(AbstractFilterParametersReader* reader)
+{
+  setNumberOfStreamDivisions(reader->readValue("NumberOfStreamDivisions", getNumberOfStreamDivisions()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  setMemoryBudget(reader->readValue("MemoryBudget", getMemoryBudget()));
+  setSliceBySlice(reader->readValue("SliceBySlice", getSliceBySlice()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::applyNumberOfThreads(itk::ProcessObject* object)
+{
+  if(m_Threads > 0)
+  {
+    object->SetNumberOfThreads(static_cast<itk::ThreadIdType>(m_Threads));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::getUnaryMathInstructionSet(ITKDream3DHelper::SIMDInstructionSet& instructionSet)
+{
+  const ITKDream3DHelper::SIMDInstructionSet supported = ITKDream3DHelper::GetSupportedSIMDInstructionSet();
+  instructionSet = supported;
+  const QString value = QString::fromLocal8Bit(qgetenv(ITKImageProcessingConstants::SIMDEnvironmentVariable.toLatin1().constData())).trimmed().toLower();
+  if(value == "off")
+  {
+    return false;
+  }
+  const ITKDream3DHelper::SIMDInstructionSet instructionSets[] = {ITKDream3DHelper::SIMDInstructionSet::None, ITKDream3DHelper::SIMDInstructionSet::SSE2,
+                                                                  ITKDream3DHelper::SIMDInstructionSet::AVX2, ITKDream3DHelper::SIMDInstructionSet::AVX512};
+  for(ITKDream3DHelper::SIMDInstructionSet requested : instructionSets)
+  {
+    if(value == ITKDream3DHelper::GetSIMDInstructionSetName(requested))
+    {
+      // A set the processor does not support is lowered to the best supported one
+      instructionSet = std::min(requested, supported);
+      break;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::filterWithUnaryMathKernel(ITKDream3DHelper::UnaryMathOperation operation)
+{
+  ITKDream3DHelper::SIMDInstructionSet instructionSet;
+  if(!getUnaryMathInstructionSet(instructionSet))
+  {
+    return false;
+  }
+  DataArrayPath path = getSelectedCellArrayPath();
+  AttributeMatrix::Pointer attributeMatrix = getDataContainerArray()->getAttributeMatrix(path);
+  if(nullptr == attributeMatrix.get())
+  {
+    return false;
+  }
+  IDataArray::Pointer inputArray = attributeMatrix->getAttributeArray(path.getDataArrayName());
+  IDataArray::Pointer outputArray = (getSaveAsNewArray() ? m_NewCellArrayPtr.lock() : inputArray);
+  if(nullptr == inputArray.get() || nullptr == outputArray.get() || inputArray->getNumberOfComponents() != 1 || outputArray->getNumberOfComponents() != 1 ||
+     inputArray->getTypeAsString() != outputArray->getTypeAsString() || inputArray->getNumberOfTuples() != outputArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  const size_t numberOfPixels = inputArray->getNumberOfTuples();
+  const int numberOfThreads = static_cast<int>(m_Threads);
+  QString pixelType;
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if(nullptr != std::dynamic_pointer_cast<FloatArrayType>(inputArray).get())
+  {
+    pixelType = getPixelTypeName<float>();
+    RunUnaryMathKernel<float>(this, numberOfThreads, operation, instructionSet, static_cast<const float*>(inputArray->getVoidPointer(0)), static_cast<float*>(outputArray->getVoidPointer(0)),
+                              numberOfPixels);
+  }
+  else if(nullptr != std::dynamic_pointer_cast<DoubleArrayType>(inputArray).get())
+  {
+    pixelType = getPixelTypeName<double>();
+    RunUnaryMathKernel<double>(this, numberOfThreads, operation, instructionSet, static_cast<const double*>(inputArray->getVoidPointer(0)), static_cast<double*>(outputArray->getVoidPointer(0)),
+                               numberOfPixels);
+  }
+  else
+  {
+    return false;
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  if(getCancel())
+  {
+    return true;
+  }
+  itk::Dream3DFilterInterruption::Pointer observer = itk::Dream3DFilterInterruption::New();
+  observer->AddStageTime(QString("Kernel (%1)").arg(ITKDream3DHelper::GetSIMDInstructionSetName(instructionSet)).toStdString(), elapsed.count());
+  notifyExecutionStatistics(observer, numberOfPixels);
+  QVector<size_t> size = attributeMatrix->getTupleDimensions();
+  writeTraceRecord(observer, pixelType, pixelType, size);
+  notifyStatusMessage(getHumanLabel(), "Complete");
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::notifyExecutionStatistics(const itk::Dream3DFilterInterruption* observer, size_t numberOfPixels)
+{
+  QStringList stages;
+  const itk::Dream3DFilterInterruption::StageTimesType& stageTimes = observer->GetStageTimes();
+  for(size_t i = 0; i < stageTimes.size(); i++)
+  {
+    stages << QString("%1: %2 s").arg(QString::fromStdString(stageTimes[i].first)).arg(stageTimes[i].second, 0, 'f', 3);
+  }
+  QString message = stages.join(", ");
+  const double totalTime = observer->GetTotalTime();
+  if(totalTime > 0.0)
+  {
+    message += QString(" | %1 Mvoxels/s").arg(static_cast<double>(numberOfPixels) / totalTime / 1.0e6, 0, 'f', 2);
+  }
+  const size_t peakMemory = getPeakResidentSetSize();
+  if(peakMemory > 0)
+  {
+    message += QString(" | Peak memory: %1 MB").arg(static_cast<double>(peakMemory) / (1024.0 * 1024.0), 0, 'f', 1);
+  }
+  notifyStatusMessage(getHumanLabel(), message);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKImageBase::getAllocatedOutputBytes()
+{
+  const QString arrayName = (getSaveAsNewArray() ? getNewCellArrayName() : getSelectedCellArrayPath().getDataArrayName());
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  IDataArray::Pointer outputArray = (nullptr != attrMat.get() ? attrMat->getAttributeArray(arrayName) : IDataArray::NullPointer());
+  if(nullptr == outputArray.get() || outputArray->getVoidPointer(0) == m_InputBuffer)
+  {
+    return 0.0;
+  }
+  return static_cast<double>(outputArray->getSize()) * static_cast<double>(outputArray->getTypeSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKImageBase::getTraceFileName()
+{
+  return QString::fromLocal8Bit(qgetenv(ITKImageProcessingConstants::TraceFileEnvironmentVariable.toLatin1().constData()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::writeTraceRecord(const itk::Dream3DFilterInterruption* observer, const QString& inputType, const QString& outputType, const QVector<size_t>& size)
+{
+  QString traceFileName = getTraceFileName();
+  if(traceFileName.isEmpty())
+  {
+    return;
+  }
+  size_t numberOfPixels = 1;
+  QJsonArray jsonSize;
+  for(int i = 0; i < size.size(); i++)
+  {
+    jsonSize.append(static_cast<double>(size[i]));
+    numberOfPixels *= size[i];
+  }
+  const double totalTime = observer->GetTotalTime();
+  const itk::Dream3DFilterInterruption::StageTimesType& stageTimes = observer->GetStageTimes();
+  QJsonObject jsonStages;
+  for(size_t i = 0; i < stageTimes.size(); i++)
+  {
+    jsonStages[QString::fromStdString(stageTimes[i].first)] = stageTimes[i].second;
+  }
+
+  QJsonObject record;
+  record["filter"] = getNameOfClass();
+  record["label"] = getHumanLabel();
+  record["version"] = getFilterVersion();
+  record["input_type"] = inputType;
+  record["output_type"] = outputType;
+  record["dimension"] = size.size();
+  record["size"] = jsonSize;
+  record["threads"] = static_cast<int>(m_Threads);
+  record["stream_divisions"] = static_cast<int>(m_StreamDivisions);
+  record["stages"] = jsonStages;
+  record["total_time"] = totalTime;
+  record["voxels_per_second"] = totalTime > 0.0 ? static_cast<double>(numberOfPixels) / totalTime : 0.0;
+  record["allocated_bytes"] = getAllocatedOutputBytes();
+  record["estimated_peak_bytes"] = m_EstimatedPeakMemory;
+  record["peak_rss_bytes"] = static_cast<double>(getPeakResidentSetSize());
+
+  // Several filters may run concurrently in the same process
+  static QMutex mutex;
+  QMutexLocker locker(&mutex);
+  QFile traceFile(traceFileName);
+  const bool newFile = !traceFile.exists() || traceFile.size() == 0;
+  if(!traceFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+  {
+    setWarningCondition(-8);
+    notifyWarningMessage(getHumanLabel(), QString("Could not open the trace file %1").arg(traceFileName), getWarningCondition());
+    return;
+  }
+
+  if(QFileInfo(traceFileName).suffix() == "jsonl")
+  {
+    traceFile.write(QJsonDocument(record).toJson(QJsonDocument::Compact));
+    traceFile.write("\n");
+    return;
+  }
+
+  // Chrome trace event format: one complete event ("X") for the filter, with the record as arguments,
+  // and one for each stage. The closing bracket of the array is optional in this format, so events
+  // can be appended to an existing file.
+  const double end = static_cast<double>(QDateTime::currentMSecsSinceEpoch()) * 1000.0;
+  double start = end - totalTime * 1.0e6;
+  const qint64 pid = QCoreApplication::applicationPid();
+  const double tid = static_cast<double>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+  QJsonObject filterEvent;
+  filterEvent["name"] = getHumanLabel();
+  filterEvent["cat"] = getNameOfClass();
+  filterEvent["ph"] = QString("X");
+  filterEvent["ts"] = start;
+  filterEvent["dur"] = totalTime * 1.0e6;
+  filterEvent["pid"] = static_cast<double>(pid);
+  filterEvent["tid"] = tid;
+  filterEvent["args"] = record;
+  if(newFile)
+  {
+    traceFile.write("[\n");
+  }
+  traceFile.write(QJsonDocument(filterEvent).toJson(QJsonDocument::Compact));
+  traceFile.write(",\n");
+  for(size_t i = 0; i < stageTimes.size(); i++)
+  {
+    QJsonObject stageEvent;
+    stageEvent["name"] = QString::fromStdString(stageTimes[i].first);
+    stageEvent["cat"] = getNameOfClass();
+    stageEvent["ph"] = QString("X");
+    stageEvent["ts"] = start;
+    stageEvent["dur"] = stageTimes[i].second * 1.0e6;
+    stageEvent["pid"] = static_cast<double>(pid);
+    stageEvent["tid"] = tid;
+    traceFile.write(QJsonDocument(stageEvent).toJson(QJsonDocument::Compact));
+    traceFile.write(",\n");
+    start += stageTimes[i].second * 1.0e6;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKImageBase::getInternalBufferFactor() const
+{
+  return 0.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::isStreamable() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::canProcessSlicesIndependently() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::isProcessingSlices()
+{
+  if(getSliceBySlice() == false)
+  {
+    return false;
+  }
+  AttributeMatrix::Pointer attributeMatrix = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  if(nullptr == attributeMatrix.get())
+  {
+    return false;
+  }
+  QVector<size_t> tDims = attributeMatrix->getTupleDimensions();
+  return tDims.size() > 2 && tDims[2] > 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::filterSliceBySlice()
+{
+  DataArrayPath path = getSelectedCellArrayPath();
+  AttributeMatrix::Pointer attributeMatrix = getDataContainerArray()->getAttributeMatrix(path);
+  QVector<size_t> tDims = attributeMatrix->getTupleDimensions();
+  const size_t numberOfSlices = tDims[2];
+  const size_t numberOfJobs = std::max<size_t>(1, std::min<size_t>(m_Threads, numberOfSlices));
+
+  // Each call builds a new instance of the ITK filter, set up with the parameters of this filter, and
+  // adds the job of one thread instead of running the pipeline.
+  m_SliceJobs.clear();
+  m_SliceOutputArray = IDataArray::NullPointer();
+  m_CollectingSliceJobs = true;
+  for(size_t i = 0; i < numberOfJobs && getErrorCondition() >= 0; i++)
+  {
+    filterInternal();
+  }
+  m_CollectingSliceJobs = false;
+  if(getErrorCondition() >= 0 && m_SliceJobs.size() != numberOfJobs)
+  {
+    setErrorCondition(-14);
+    notifyErrorMessage(getHumanLabel(), "This filter cannot process the slices of the image independently", getErrorCondition());
+  }
+  if(getErrorCondition() < 0)
+  {
+    m_SliceJobs.clear();
+    m_SliceOutputArray = IDataArray::NullPointer();
+    return;
+  }
+
+  SliceJobsData data;
+  data.filter = this;
+  data.jobs = &m_SliceJobs;
+  data.numberOfSlices = numberOfSlices;
+  data.nextSlice = 0;
+  data.processedSlices = 0;
+  data.failed = false;
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  threader->SetNumberOfThreads(static_cast<itk::ThreadIdType>(m_SliceJobs.size()));
+  threader->SetSingleMethod(SliceJobsThreaderCallback, &data);
+  threader->SingleMethodExecute();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  m_SliceJobs.clear();
+  IDataArray::Pointer outputArray = m_SliceOutputArray;
+  m_SliceOutputArray = IDataArray::NullPointer();
+
+  if(data.failed)
+  {
+    setErrorCondition(-55555);
+    QString errorMessage = "ITK exception was thrown while filtering input image: %1";
+    notifyErrorMessage(getHumanLabel(), errorMessage.arg(data.errorMessage), getErrorCondition());
+    return;
+  }
+  if(getCancel())
+  {
+    return;
+  }
+  if(nullptr != outputArray.get())
+  {
+    // The output pixel type is not the input one: the filtered slices were written in a new array
+    attributeMatrix->removeAttributeArray(path.getDataArrayName());
+    attributeMatrix->addAttributeArray(path.getDataArrayName(), outputArray);
+  }
+
+  itk::Dream3DFilterInterruption::Pointer observer = itk::Dream3DFilterInterruption::New();
+  observer->AddStageTime(QString("Slices (%1 threads)").arg(numberOfJobs).toStdString(), elapsed.count());
+  notifyExecutionStatistics(observer, attributeMatrix->getNumberOfTuples());
+  writeTraceRecord(observer, m_SliceInputType, m_SliceOutputType, tDims);
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -87,7 +654,18 @@ void ITKImageBase::execute()
   {
     return;
   }
-  this->filterInternal();
+  // Tells the results written in place from the allocated ones in the trace
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  IDataArray::Pointer inputArray = (nullptr != attrMat.get() ? attrMat->getAttributeArray(getSelectedCellArrayPath().getDataArrayName()) : IDataArray::NullPointer());
+  m_InputBuffer = (nullptr != inputArray.get() ? inputArray->getVoidPointer(0) : nullptr);
+  if(isProcessingSlices())
+  {
+    this->filterSliceBySlice();
+  }
+  else
+  {
+    this->filterInternal();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -13,10 +13,24 @@
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkInPlaceDream3DDataToImageFilter.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkInPlaceImageToDream3DDataFilter.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkUnaryMathKernels.h"
 #include "itkImageToImageFilter.h"
 
+#include <itkBinaryFunctorImageFilter.h>
 #include <itkCastImageFilter.h>
+#include <itkImageIOBase.h>
+#include <itkInPlaceImageFilter.h>
+#include <itkMultiThreader.h>
 #include <itkNumericTraits.h>
+#include <itkStreamingImageFilter.h>
+#include <itkUnaryFunctorImageFilter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <vector>
 
 // The sitkExplicitITK.h header must be AFTER any ITK includes above or
 // the code will not compile on Windows. Further, windows does not seem
@@ -48,6 +62,18 @@ public:
   SIMPL_FILTER_PARAMETER(bool, SaveAsNewArray)
   Q_PROPERTY(bool SaveAsNewArray READ getSaveAsNewArray WRITE setSaveAsNewArray)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfStreamDivisions)
+  Q_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
+
+  SIMPL_FILTER_PARAMETER(int, NumberOfThreads)
+  Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+
+  SIMPL_FILTER_PARAMETER(int, MemoryBudget)
+  Q_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
+
+  SIMPL_FILTER_PARAMETER(bool, SliceBySlice)
+  Q_PROPERTY(bool SliceBySlice READ getSliceBySlice WRITE setSliceBySlice)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -191,6 +217,31 @@ protected:
   {
     typedef typename itk::NumericTraits<InputPixelType>::ValueType InputValueType;
     typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+    // Check execution parameters
+    if(getNumberOfStreamDivisions() < 1)
+    {
+      setErrorCondition(-5);
+      notifyErrorMessage(getHumanLabel(), "Number of stream divisions must be greater or equal than 1", getErrorCondition());
+      return;
+    }
+    if(getNumberOfThreads() < 0)
+    {
+      setErrorCondition(-7);
+      notifyErrorMessage(getHumanLabel(), "Number of threads must be greater or equal than 0", getErrorCondition());
+      return;
+    }
+    if(getMemoryBudget() < 0)
+    {
+      setErrorCondition(-6);
+      notifyErrorMessage(getHumanLabel(), "Memory budget must be greater or equal than 0", getErrorCondition());
+      return;
+    }
+    if(getSliceBySlice() && !canProcessSlicesIndependently())
+    {
+      setErrorCondition(-14);
+      notifyErrorMessage(getHumanLabel(), "This filter cannot process the slices of the image independently", getErrorCondition());
+      return;
+    }
     // Check data array
     imageCheck<InputPixelType, Dimension>(getSelectedCellArrayPath());
     if(getErrorCondition() < 0)
@@ -214,6 +265,124 @@ protected:
       m_NewCellArrayPtr = DataArray<OutputValueType>::NullPointer();
       m_NewCellArray = nullptr;
     }
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    estimateMemoryUsage<InputPixelType, OutputPixelType, Dimension>();
+  }
+
+  /**
+   * @brief getInternalBufferFactor Returns the number of image-sized float buffers (per pixel component)
+   * the ITK filter allocates on top of its output image. Filters with large internal buffers reimplement it.
+   */
+  virtual double getInternalBufferFactor() const;
+
+  /**
+   * @brief canProcessSlicesIndependently Returns true if the 2D version of the filter can be applied to each
+   * slice of a 3D image (SliceBySlice parameter). Filters with a second input image, and filters that label
+   * the objects of the whole image, reimplement it.
+   */
+  virtual bool canProcessSlicesIndependently() const;
+
+  /**
+   * @brief isProcessingSlices Returns true if the slices of the selected 3D image are filtered independently
+   */
+  bool isProcessingSlices();
+
+  /**
+   * @brief isStreamable Returns false if the ITK filter needs its whole input image to compute any part of
+   * its output (e.g. distance maps, watersheds, diffusion, recursive Gaussians). Such filters are always run
+   * in one piece: stream divisions would only make them filter the whole image once per piece.
+   */
+  virtual bool isStreamable() const;
+
+  /**
+   * @brief estimateMemoryUsage Estimates the peak memory used to filter the selected array and picks the
+   * number of stream divisions and of threads. If a memory budget is set, the number of stream divisions of
+   * streamable filters is increased until their internal buffers fit in it, and the number of slices
+   * processed at the same time is limited in slice by slice mode. Unless the number of threads is set,
+   * ITK's global default number of threads is used.
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void estimateMemoryUsage()
+  {
+    typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+    m_StreamDivisions = static_cast<unsigned int>(getNumberOfStreamDivisions());
+
+    DataArrayPath path = getSelectedCellArrayPath();
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getDataContainer(path.getDataContainerName())->getAttributeMatrix(path.getAttributeMatrixName());
+    QVector<size_t> tDims = attrMat->getTupleDimensions();
+    double numberOfPixels = 1.0;
+    for(int i = 0; i < tDims.size(); i++)
+    {
+      numberOfPixels *= static_cast<double>(tDims[i]);
+    }
+    // Input and output arrays are fully allocated whatever the number of stream divisions,
+    // only the buffers internal to the ITK pipeline are split.
+    const double outputComponents = static_cast<double>(sizeof(OutputPixelType) / sizeof(OutputValueType));
+    const double arraysSize = numberOfPixels * static_cast<double>(sizeof(InputPixelType) + sizeof(OutputPixelType));
+    double internalSize = numberOfPixels * outputComponents * sizeof(float) * getInternalBufferFactor();
+    const double megaBytes = 1024.0 * 1024.0;
+    const double budget = static_cast<double>(getMemoryBudget()) * megaBytes;
+
+    if(getNumberOfThreads() > 0)
+    {
+      m_Threads = static_cast<unsigned int>(getNumberOfThreads());
+    }
+    else
+    {
+      m_Threads = static_cast<unsigned int>(itk::MultiThreader::GetGlobalDefaultNumberOfThreads());
+    }
+
+    if(isProcessingSlices())
+    {
+      // Each slice is processed in one piece, and only the slices being processed use internal buffers.
+      const double numberOfSlices = static_cast<double>(tDims[2]);
+      const double sliceInternalSize = internalSize / numberOfSlices;
+      if(getNumberOfThreads() == 0 && getMemoryBudget() > 0 && sliceInternalSize > 0.0)
+      {
+        const double fittingSlices = std::floor(std::max(0.0, budget - arraysSize) / sliceInternalSize);
+        m_Threads = static_cast<unsigned int>(std::max(1.0, std::min(static_cast<double>(m_Threads), fittingSlices)));
+      }
+      internalSize = sliceInternalSize * std::min(numberOfSlices, static_cast<double>(m_Threads));
+      m_StreamDivisions = 1;
+    }
+    else if(!isStreamable())
+    {
+      if(m_StreamDivisions > 1)
+      {
+        setWarningCondition(-5);
+        notifyWarningMessage(getHumanLabel(), "This filter needs the whole image at once: the stream divisions are not used", getWarningCondition());
+      }
+      m_StreamDivisions = 1;
+    }
+    else if(getMemoryBudget() > 0)
+    {
+      // Pieces are split along the slowest dimension: there cannot be more pieces than slices.
+      const unsigned int maxDivisions = static_cast<unsigned int>(std::max<size_t>(tDims[Dimension - 1], 1));
+      if(budget > arraysSize)
+      {
+        const double divisions = std::ceil(internalSize / (budget - arraysSize));
+        m_StreamDivisions = std::max(m_StreamDivisions, static_cast<unsigned int>(std::min(divisions, static_cast<double>(maxDivisions))));
+      }
+      else
+      {
+        m_StreamDivisions = std::max(m_StreamDivisions, maxDivisions);
+      }
+    }
+    m_EstimatedPeakMemory = arraysSize + internalSize / m_StreamDivisions;
+
+    if(getMemoryBudget() > 0 && m_EstimatedPeakMemory > budget)
+    {
+      setWarningCondition(-6);
+      QString warningMessage = "Estimated peak memory (%1 MB) exceeds the memory budget (%2 MB)";
+      notifyWarningMessage(getHumanLabel(), warningMessage.arg(m_EstimatedPeakMemory / megaBytes, 0, 'f', 1).arg(getMemoryBudget()), getWarningCondition());
+    }
+    if(getInPreflight())
+    {
+      QString statusMessage = "Estimated peak memory: %1 MB (%2 stream divisions, %3 threads)";
+      notifyStatusMessage(getHumanLabel(), statusMessage.arg(m_EstimatedPeakMemory / megaBytes, 0, 'f', 1).arg(m_StreamDivisions).arg(m_Threads));
+    }
   }
 
   /**
@@ -246,13 +415,446 @@ protected:
     }
   }
 
+  /**
+   * @brief setupExecutionFilterParameters Appends the parameters shared by all the ITK image filters
+   * that control how the ITK pipeline is executed.
+   */
+  void setupExecutionFilterParameters(FilterParameterVector& parameters);
+
+  /**
+   * @brief readExecutionFilterParameters Reads the parameters added by setupExecutionFilterParameters
+   */
+  void readExecutionFilterParameters(AbstractFilterParametersReader* reader);
+
+  /**
+  * @brief Sets the number of threads picked by estimateMemoryUsage on an ITK process object
+  */
+  void applyNumberOfThreads(itk::ProcessObject* object);
+
+  /**
+  * @brief Enables or disables in-place execution on filters deriving from itk::InPlaceImageFilter.
+    It is enabled when SaveAsNewArray is off, the functor filters disabling it by default: pixel-wise
+    filters whose output type is the input type then write their result in the buffer of the selected
+    array. ITK falls back to a new output buffer when the types differ (CanRunInPlace()).
+  */
+  template <typename TInputImage, typename TOutputImage> void setFilterInPlace(itk::InPlaceImageFilter<TInputImage, TOutputImage>* filter, bool inPlace)
+  {
+    filter->SetInPlace(inPlace);
+  }
+
+  /**
+  * @brief Overload for filters that cannot run in place: nothing to do.
+  */
+  void setFilterInPlace(itk::ProcessObject*, bool)
+  {
+  }
+
+  /**
+  * @brief Grafts 'outputArray' onto the output of 'source' so that ITK writes the result directly
+    into it instead of allocating its own output buffer. Nothing is done if there is no array or if
+    the output image does not have as many pixels as the array has tuples (the output bridge then
+    resizes the attribute matrix).
+  */
+  template <typename OutputImageType> void graftOutputArray(itk::ImageSource<OutputImageType>* source, IDataArray::Pointer outputArray)
+  {
+    if(nullptr == outputArray.get())
+    {
+      return;
+    }
+    source->UpdateOutputInformation();
+    typename OutputImageType::RegionType region = source->GetOutput()->GetLargestPossibleRegion();
+    if(region.GetNumberOfPixels() != outputArray->getNumberOfTuples())
+    {
+      return;
+    }
+    typedef typename OutputImageType::PixelType OutputPixelType;
+    typedef typename OutputImageType::PixelContainerType PixelContainerType;
+    typename PixelContainerType::Pointer container = PixelContainerType::New();
+    container->SetImportPointer(static_cast<OutputPixelType*>(outputArray->getVoidPointer(0)), region.GetNumberOfPixels(), false);
+    typename OutputImageType::Pointer image = OutputImageType::New();
+    image->CopyInformation(source->GetOutput());
+    image->SetRegions(region);
+    image->SetPixelContainer(container);
+    // Otherwise the grafted buffer is released at the beginning of the update
+    source->ReleaseDataBeforeUpdateFlagOff();
+    source->GraftOutput(image);
+  }
+
+  /**
+  * @brief Returns true if the pieces of a streamed output can be written straight in the buffer of
+    the selected array: each output pixel of a functor filter only depends on the same input pixel,
+    so a piece never reads input pixels overwritten by the previous pieces.
+  */
+  template <typename InputImageType, typename OutputImageType, typename FunctorType>
+  bool canStreamInSelectedArray(itk::UnaryFunctorImageFilter<InputImageType, OutputImageType, FunctorType>*)
+  {
+    return true;
+  }
+
+  /**
+  * @brief Overload for the binary functor filters (e.g. masks): pixel-wise as well.
+  */
+  template <typename Input1ImageType, typename Input2ImageType, typename OutputImageType, typename FunctorType>
+  bool canStreamInSelectedArray(itk::BinaryFunctorImageFilter<Input1ImageType, Input2ImageType, OutputImageType, FunctorType>*)
+  {
+    return true;
+  }
+
+  /**
+  * @brief Overload for the other filters: their pieces may read the neighbors of the output piece.
+  */
+  bool canStreamInSelectedArray(itk::ProcessObject*)
+  {
+    return false;
+  }
+
+  /**
+  * @brief Returns the selected array if it holds pixels of the output type of the pipeline, or a null
+    pointer otherwise.
+  */
+  template <typename OutputImageType> IDataArray::Pointer getSelectedArrayOfOutputType()
+  {
+    typedef typename OutputImageType::PixelType OutputPixelType;
+    typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+    IDataArray::Pointer inputArray = (nullptr != attrMat.get() ? attrMat->getAttributeArray(getSelectedCellArrayPath().getDataArrayName()) : IDataArray::NullPointer());
+    if(nullptr == std::dynamic_pointer_cast<DataArray<OutputValueType>>(inputArray).get() || inputArray->getNumberOfComponents() != static_cast<int>(sizeof(OutputPixelType) / sizeof(OutputValueType)))
+    {
+      return IDataArray::NullPointer();
+    }
+    return inputArray;
+  }
+
+  /**
+  * @brief Allocates the array in which the pieces of a streamed output are written when the
+    result replaces the selected array, or returns a null pointer if the output image does not
+    have as many pixels as the selected array has tuples.
+  */
+  template <typename OutputImageType> IDataArray::Pointer createStreamedOutputArray(itk::ImageSource<OutputImageType>* source)
+  {
+    typedef typename OutputImageType::PixelType OutputPixelType;
+    typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+    source->UpdateOutputInformation();
+    if(nullptr == attrMat.get() || source->GetOutput()->GetLargestPossibleRegion().GetNumberOfPixels() != attrMat->getNumberOfTuples())
+    {
+      return IDataArray::NullPointer();
+    }
+    QVector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>();
+    return DataArray<OutputValueType>::CreateArray(attrMat->getNumberOfTuples(), cDims, getSelectedCellArrayPath().getDataArrayName(), true);
+  }
+
+  /**
+  * @brief Returns true if 'image' holds its pixels in the DREAM.3D array created by this filter,
+    in which case the result does not need to be copied back.
+  */
+  template <typename ImageType> bool isWrittenInNewCellArray(ImageType* image) const
+  {
+    return getSaveAsNewArray() == true && nullptr != m_NewCellArray && static_cast<void*>(image->GetBufferPointer()) == m_NewCellArray;
+  }
+
+  /**
+  * @brief Returns true if the filter ran in place on the buffer of the selected array, which then
+    already holds the result. The array is kept as it is: it may not own its buffer (memory mapped file).
+  */
+  template <typename ImageType> bool isWrittenInSelectedArray(ImageType* image)
+  {
+    if(getSaveAsNewArray() == true)
+    {
+      return false;
+    }
+    DataArrayPath path = getSelectedCellArrayPath();
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(path);
+    if(nullptr == attrMat.get())
+    {
+      return false;
+    }
+    IDataArray::Pointer inputArray = attrMat->getAttributeArray(path.getDataArrayName());
+    return nullptr != inputArray.get() && static_cast<void*>(image->GetBufferPointer()) == inputArray->getVoidPointer(0);
+  }
+
+  /**
+  * @brief Updates the pipeline ending with 'filter' and returns its disconnected output image.
+    If more than one stream division is requested (or needed to fit in the memory budget), the output is requested piece by piece
+    (along the slowest dimension) so that the intermediate buffers only hold one piece at a time. The pieces are written in the
+    created array, in the selected array itself for pixel-wise filters that keep its pixel type, or otherwise in an array
+    allocated up front that replaces the selected array once complete.
+  */
+  template <typename OutputImageType, typename FilterType> typename OutputImageType::Pointer updatePipeline(FilterType* filter, itk::Dream3DFilterInterruption* observer)
+  {
+    typedef itk::StreamingImageFilter<OutputImageType, OutputImageType> StreamerType;
+    typename StreamerType::Pointer streamer;
+    itk::ImageSource<OutputImageType>* source = filter;
+    if(m_StreamDivisions > 1)
+    {
+      streamer = StreamerType::New();
+      streamer->SetInput(filter->GetOutput());
+      streamer->SetNumberOfStreamDivisions(m_StreamDivisions);
+      // Only observe the progress: the time is spent in the streamed stages.
+      streamer->AddObserver(itk::ProgressEvent(), observer);
+      applyNumberOfThreads(streamer);
+      source = streamer.GetPointer();
+    }
+    IDataArray::Pointer outputArray = m_NewCellArrayPtr.lock();
+    if(getSaveAsNewArray() == false)
+    {
+      // Without streaming, the output goes in place or is handed over by the output bridge without a copy
+      m_StreamedOutputArray = IDataArray::NullPointer();
+      outputArray = IDataArray::NullPointer();
+      if(m_StreamDivisions > 1)
+      {
+        outputArray = (canStreamInSelectedArray(filter) ? getSelectedArrayOfOutputType<OutputImageType>() : IDataArray::NullPointer());
+        if(nullptr == outputArray.get())
+        {
+          m_StreamedOutputArray = createStreamedOutputArray<OutputImageType>(source);
+          outputArray = m_StreamedOutputArray;
+        }
+      }
+    }
+    graftOutputArray<OutputImageType>(source, outputArray);
+    source->Update();
+    typename OutputImageType::Pointer image = source->GetOutput();
+    image->DisconnectPipeline();
+    return image;
+  }
+
+  /**
+  * @brief Stores the filtered image in the DREAM.3D data container, either as a new array or in place
+    of the input array. Nothing needs to be done if ITK wrote the image directly in the created array
+    or in the input array.
+  */
+  template <typename OutputPixelType, unsigned int Dimension> void writeOutputImage(itk::Dream3DImage<OutputPixelType, Dimension>* image, itk::Dream3DFilterInterruption* observer)
+  {
+    IDataArray::Pointer streamedOutputArray = m_StreamedOutputArray;
+    m_StreamedOutputArray = IDataArray::NullPointer();
+    if(nullptr != streamedOutputArray.get() && static_cast<void*>(image->GetBufferPointer()) == streamedOutputArray->getVoidPointer(0))
+    {
+      AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+      attrMat->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
+      attrMat->addAttributeArray(getSelectedCellArrayPath().getDataArrayName(), streamedOutputArray);
+      return;
+    }
+    if(isWrittenInNewCellArray(image) || isWrittenInSelectedArray(image))
+    {
+      return;
+    }
+    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+    std::string outputArrayName(getNewCellArrayName().toStdString());
+
+    if(getSaveAsNewArray() == false)
+    {
+      outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
+      AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
+      // Remove the original input data array
+      attrMat->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
+    }
+
+    typedef itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension> toDream3DType;
+    typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
+    toDream3DFilter->SetInput(image);
+    toDream3DFilter->SetInPlace(true);
+    toDream3DFilter->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
+    toDream3DFilter->SetDataArrayName(outputArrayName);
+    toDream3DFilter->SetDataContainer(dc);
+    applyNumberOfThreads(toDream3DFilter);
+    observer->AddStage(toDream3DFilter, "Bridge out");
+    toDream3DFilter->Update();
+  }
+
+  /**
+  * @brief Reports the time spent in each stage of the pipeline, the throughput and the peak
+    memory used by the process.
+  */
+  void notifyExecutionStatistics(const itk::Dream3DFilterInterruption* observer, size_t numberOfPixels);
+
+  /**
+  * @brief Returns the name of the component type of 'PixelType' followed by its number of components
+    if it has more than one, e.g. "float" or "unsigned_char[3]".
+  */
+  template <typename PixelType> static QString getPixelTypeName()
+  {
+    typedef typename itk::NumericTraits<PixelType>::ValueType ValueType;
+    QString name = QString::fromStdString(itk::ImageIOBase::GetComponentTypeAsString(itk::ImageIOBase::MapPixelType<ValueType>::CType));
+    const size_t numberOfComponents = sizeof(PixelType) / sizeof(ValueType);
+    if(numberOfComponents > 1)
+    {
+      name += QString("[%1]").arg(numberOfComponents);
+    }
+    return name;
+  }
+
+  /**
+  * @brief Appends a performance record of this execution to the trace file, if tracing is enabled.
+  */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension>
+  void writeTraceRecord(const itk::Dream3DFilterInterruption* observer, const itk::Size<Dimension>& imageSize)
+  {
+    if(getTraceFileName().isEmpty())
+    {
+      return;
+    }
+    QVector<size_t> size;
+    for(unsigned int i = 0; i < Dimension; i++)
+    {
+      size.push_back(imageSize[i]);
+    }
+    writeTraceRecord(observer, getPixelTypeName<InputPixelType>(), getPixelTypeName<OutputPixelType>(), size);
+  }
+
+  /**
+  * @brief Appends a performance record to the trace file: filter, pixel types, image size, threads,
+    time spent in each stage and memory. Files with the ".jsonl" extension get one JSON object per line,
+    the other files are written in the Chrome trace event format (chrome://tracing, Perfetto).
+  */
+  void writeTraceRecord(const itk::Dream3DFilterInterruption* observer, const QString& inputType, const QString& outputType, const QVector<size_t>& size);
+
+  /**
+  * @brief Returns the size in bytes of the output array if this execution allocated it, or 0 if the
+    result was written in the buffer of the selected array.
+  */
+  double getAllocatedOutputBytes();
+
+  /**
+  * @brief Returns the trace file set in the ITKIMAGEPROCESSING_TRACE_FILE environment variable, or an empty
+    string if tracing is disabled.
+  */
+  static QString getTraceFileName();
+
+  /**
+  * @brief Returns an image of the size and geometry of 'information' whose pixels are the ones of 'buffer'.
+    The buffer is not copied and remains owned by its DREAM.3D array.
+  */
+  template <typename PixelType, unsigned int Dimension>
+  static typename itk::Dream3DImage<PixelType, Dimension>::Pointer wrapBuffer(PixelType* buffer, const itk::ImageBase<Dimension>* information)
+  {
+    typedef itk::Dream3DImage<PixelType, Dimension> ImageType;
+    typename ImageType::Pointer image = ImageType::New();
+    image->CopyInformation(information);
+    image->SetRegions(information->GetLargestPossibleRegion());
+    typename ImageType::PixelContainerType::Pointer container = ImageType::PixelContainerType::New();
+    container->SetImportPointer(buffer, image->GetLargestPossibleRegion().GetNumberOfPixels(), false);
+    image->SetPixelContainer(container);
+    return image;
+  }
+
+  /**
+  * @brief Called instead of running the pipeline from 'first' to 'last' when the slices are processed
+    independently: adds the job of one thread, which updates this pipeline for each of the slices it is
+    given. The input and output images of a slice are views of the DREAM.3D arrays. The result is only
+    copied if the output has the input pixel type and is not saved as a new array, or if the last filter
+    runs in place on a buffer of the pipeline.
+  */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FirstType, typename LastType>
+  void addSliceJob(FirstType* first, LastType* last, const std::vector<itk::ProcessObject::Pointer>& stages)
+  {
+    typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
+    typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+    typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+
+    DataArrayPath path = getSelectedCellArrayPath();
+    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+    ImageGeom::Pointer imageGeom = std::dynamic_pointer_cast<ImageGeom>(dc->getGeometry());
+    IDataArray::Pointer inputArray = dc->getAttributeMatrix(path.getAttributeMatrixName())->getAttributeArray(path.getDataArrayName());
+    QVector<float> origin(3, 0);
+    QVector<float> spacing(3, 0);
+    QVector<size_t> tDims(3, 1);
+    imageGeom->getOrigin(origin[0], origin[1], origin[2]);
+    imageGeom->getResolution(spacing[0], spacing[1], spacing[2]);
+    imageGeom->getDimensions(tDims[0], tDims[1], tDims[2]);
+
+    // Geometry of a slice
+    typename InputImageType::Pointer sliceInformation = InputImageType::New();
+    typename InputImageType::PointType sliceOrigin;
+    typename InputImageType::SpacingType sliceSpacing;
+    typename InputImageType::SizeType sliceSize;
+    for(unsigned int i = 0; i < Dimension; i++)
+    {
+      sliceOrigin[i] = origin[i];
+      sliceSpacing[i] = spacing[i];
+      sliceSize[i] = (i < 2 ? tDims[i] : 1);
+    }
+    sliceInformation->SetOrigin(sliceOrigin);
+    sliceInformation->SetSpacing(sliceSpacing);
+    sliceInformation->SetRegions(sliceSize);
+    const size_t numberOfPixels = sliceInformation->GetLargestPossibleRegion().GetNumberOfPixels();
+
+    // Where the result of each slice is written: the created array, a new array that replaces the input
+    // array at the end if the pixel type changes, or the input array itself.
+    InputPixelType* input = static_cast<InputPixelType*>(inputArray->getVoidPointer(0));
+    OutputPixelType* output = nullptr;
+    if(getSaveAsNewArray() == true)
+    {
+      output = static_cast<OutputPixelType*>(m_NewCellArray);
+    }
+    else if(!std::is_same<InputPixelType, OutputPixelType>::value)
+    {
+      if(nullptr == m_SliceOutputArray.get())
+      {
+        m_SliceOutputArray = DataArray<OutputValueType>::CreateArray(inputArray->getNumberOfTuples(), ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>(), path.getDataArrayName(), true);
+      }
+      output = static_cast<OutputPixelType*>(m_SliceOutputArray->getVoidPointer(0));
+    }
+
+    // Checked once, before any thread starts
+    first->SetInput(wrapBuffer<InputPixelType, Dimension>(input, sliceInformation));
+    last->UpdateOutputInformation();
+    if(last->GetOutput()->GetLargestPossibleRegion().GetNumberOfPixels() != numberOfPixels)
+    {
+      setErrorCondition(-15);
+      notifyErrorMessage(getHumanLabel(), "The slices cannot be processed independently: the filter changes the size of the image", getErrorCondition());
+      return;
+    }
+
+    // The slices are processed concurrently: each pipeline runs in the thread of its job with a single
+    // thread, and the progress and cancellation are handled between slices.
+    for(size_t i = 0; i < stages.size(); i++)
+    {
+      stages[i]->RemoveAllObservers();
+      stages[i]->SetNumberOfThreads(1);
+    }
+    if(nullptr != output)
+    {
+      // Otherwise the grafted buffer is released at the beginning of the update
+      last->ReleaseDataBeforeUpdateFlagOff();
+    }
+    m_SliceInputType = getPixelTypeName<InputPixelType>();
+    m_SliceOutputType = getPixelTypeName<OutputPixelType>();
+
+    // 'stages' is captured to keep the pipeline alive as long as the job.
+    m_SliceJobs.push_back([first, last, stages, sliceInformation, numberOfPixels, input, output](size_t slice) {
+      const size_t offset = slice * numberOfPixels;
+      first->SetInput(wrapBuffer<InputPixelType, Dimension>(input + offset, sliceInformation));
+      OutputPixelType* destination = (nullptr != output ? output + offset : reinterpret_cast<OutputPixelType*>(input + offset));
+      if(nullptr != output)
+      {
+        last->GraftOutput(wrapBuffer<OutputPixelType, Dimension>(destination, sliceInformation));
+      }
+      last->Update();
+      const OutputPixelType* result = last->GetOutput()->GetBufferPointer();
+      if(result != destination)
+      {
+        ::memcpy(destination, result, numberOfPixels * sizeof(OutputPixelType));
+      }
+    });
+  }
+
   /**
   * @brief Applies the filter
   */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType> void filter(FilterType* filter)
   {
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+    interruption->SetFilter(this);
+    itk::Size<Dimension> imageSize;
+    imageSize.Fill(0);
     try
     {
+      if(m_CollectingSliceJobs)
+      {
+        setFilterInPlace(filter, getSaveAsNewArray() == false);
+        addSliceJob<InputPixelType, OutputPixelType, Dimension>(filter, filter, {filter});
+        return;
+      }
       DataArrayPath dap = getSelectedCellArrayPath();
       DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dap.getDataContainerName());
 
@@ -262,38 +864,21 @@ protected:
       typename toITKType::Pointer toITK = toITKType::New();
       toITK->SetInput(dc);
       toITK->SetInPlace(true);
+      applyNumberOfThreads(toITK);
       toITK->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
       toITK->SetDataArrayName(getSelectedCellArrayPath().getDataArrayName().toStdString());
-
-      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
-      interruption->SetFilter(this);
+      interruption->AddStage(toITK, "Bridge in");
 
       // Set up filter
       filter->SetInput(toITK->GetOutput());
-      filter->AddObserver(itk::ProgressEvent(), interruption);
-      filter->Update();
+      interruption->AddStage(filter, "Filter");
+      applyNumberOfThreads(filter);
+      // The input array is kept when a new array is saved: the filter must not overwrite it.
+      setFilterInPlace(filter, getSaveAsNewArray() == false);
 
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = filter->GetOutput();
-      image->DisconnectPipeline();
-      std::string outputArrayName(getNewCellArrayName().toStdString());
-
-      if(getSaveAsNewArray() == false)
-      {
-        outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
-        AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
-        // Remove the original input data array
-        attrMat->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
-      }
-
-      typedef itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension> toDream3DType;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+      typename OutputImageType::Pointer image = updatePipeline<OutputImageType>(filter, interruption);
+      imageSize = image->GetLargestPossibleRegion().GetSize();
+      writeOutputImage<OutputPixelType, Dimension>(image, interruption);
     } catch(itk::ExceptionObject& err)
     {
       setErrorCondition(-55555);
@@ -302,6 +887,8 @@ protected:
       return;
     }
 
+    notifyExecutionStatistics(interruption, imageSize.CalculateProductOfElements());
+    writeTraceRecord<InputPixelType, OutputPixelType, Dimension>(interruption, imageSize);
     notifyStatusMessage(getHumanLabel(), "Complete");
   }
 
@@ -310,6 +897,10 @@ protected:
   */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType> void filterCastToFloat(FilterType* filter)
   {
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+    interruption->SetFilter(this);
+    itk::Size<Dimension> imageSize;
+    imageSize.Fill(0);
     try
     {
       DataArrayPath dap = getSelectedCellArrayPath();
@@ -320,48 +911,53 @@ protected:
       typename toITKType::Pointer toITK = toITKType::New();
       toITK->SetInput(dc);
       toITK->SetInPlace(true);
+      applyNumberOfThreads(toITK);
       toITK->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
       toITK->SetDataArrayName(getSelectedCellArrayPath().getDataArrayName().toStdString());
-
-      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
-      interruption->SetFilter(this);
+      interruption->AddStage(toITK, "Bridge in");
 
       typedef typename toITKType::ImageType InputImageType;
       typedef itk::CastImageFilter<InputImageType, FloatImageType> CasterToType;
       typename CasterToType::Pointer casterTo = CasterToType::New();
       casterTo->SetInput(toITK->GetOutput());
+      applyNumberOfThreads(casterTo);
+      interruption->AddStage(casterTo, "Cast");
+      // If the input already is a float image, the cast simply passes the input buffer through.
+      casterTo->InPlaceOn();
+      // The intermediate float images are released as soon as they are used. In a streamed run, the
+      // next piece would then have to compute them again, which for filters that need the whole image
+      // means running the whole filter once per piece.
+      const bool releaseData = (m_StreamDivisions == 1);
+      casterTo->SetReleaseDataFlag(releaseData);
 
       // Set up filter
       filter->SetInput(casterTo->GetOutput());
-      filter->AddObserver(itk::ProgressEvent(), interruption);
+      interruption->AddStage(filter, "Filter");
+      applyNumberOfThreads(filter);
+      // The float copy of the input is private to this pipeline: the filter can use it as its
+      // output buffer instead of allocating a second float image. If no copy was made, the
+      // filter works on the input array, which can only be overwritten if it is not kept.
+      setFilterInPlace(filter, !std::is_same<InputImageType, FloatImageType>::value || getSaveAsNewArray() == false);
+      filter->SetReleaseDataFlag(releaseData);
 
       typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
       typedef itk::CastImageFilter<FloatImageType, OutputImageType> CasterFromType;
       typename CasterFromType::Pointer casterFrom = CasterFromType::New();
       casterFrom->SetInput(filter->GetOutput());
-      casterFrom->Update();
-
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = casterFrom->GetOutput();
-      image->DisconnectPipeline();
-      std::string outputArrayName(getNewCellArrayName().toStdString());
+      applyNumberOfThreads(casterFrom);
+      interruption->AddStage(casterFrom, "Cast");
+      // Write in the created array if there is one, otherwise pass the float buffer through
+      // if the output is a float image.
+      casterFrom->SetInPlace(getSaveAsNewArray() == false);
 
-      if(getSaveAsNewArray() == false)
+      if(m_CollectingSliceJobs)
       {
-        outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
-        AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
-        // Remove the original input data array
-        attrMat->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
+        addSliceJob<InputPixelType, OutputPixelType, Dimension>(casterTo.GetPointer(), casterFrom.GetPointer(), {casterTo.GetPointer(), filter, casterFrom.GetPointer()});
+        return;
       }
-
-      typedef itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension> toDream3DType;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+      typename OutputImageType::Pointer image = updatePipeline<OutputImageType>(casterFrom.GetPointer(), interruption);
+      imageSize = image->GetLargestPossibleRegion().GetSize();
+      writeOutputImage<OutputPixelType, Dimension>(image, interruption);
     } catch(itk::ExceptionObject& err)
     {
       setErrorCondition(-55556);
@@ -370,9 +966,41 @@ protected:
       return;
     }
 
+    notifyExecutionStatistics(interruption, imageSize.CalculateProductOfElements());
+    writeTraceRecord<InputPixelType, OutputPixelType, Dimension>(interruption, imageSize);
     notifyStatusMessage(getHumanLabel(), "Complete");
   }
 
+  /**
+  * @brief Applies a pixel-wise math filter. Scalar float and double arrays are processed by the kernel
+    of 'operation', directly on the DREAM.3D buffers and with SIMD instructions chosen at run time. The
+    other arrays go through 'filter' as usual.
+  */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
+  void filterUnaryMath(FilterType* filter, ITKDream3DHelper::UnaryMathOperation operation)
+  {
+    // The kernel processes the whole array at once: slices are filtered by the ITK filter.
+    if(!m_CollectingSliceJobs && filterWithUnaryMathKernel(operation))
+    {
+      return;
+    }
+    this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  }
+
+  /**
+  * @brief Runs the kernel of 'operation' on the selected array, in place or into the created array.
+    Returns false, without doing anything, if the array is not a scalar float or double array or if
+    the kernels are disabled.
+  */
+  bool filterWithUnaryMathKernel(ITKDream3DHelper::UnaryMathOperation operation);
+
+  /**
+  * @brief Returns false if the unary math kernels are disabled by setting the ITKIMAGEPROCESSING_SIMD
+    environment variable to "off". Otherwise sets 'instructionSet' to the one named by the variable
+    ("none", "sse2", "avx2" or "avx512"), or to the best one supported by the processor if it is not set.
+  */
+  static bool getUnaryMathInstructionSet(ITKDream3DHelper::SIMDInstructionSet& instructionSet);
+
   /**
   * @brief CheckIntegerEntry: Input types can only be of certain types (float, double, bool, int).
     For the other type, we have to use one of this primitive type, and verify that the
@@ -426,6 +1054,12 @@ protected:
   */
   void virtual filterInternal() = 0;
 
+  /**
+  * @brief Applies the 2D version of the filter to each slice of the selected 3D image. The slices are shared
+    between threads, each of them running its own instance of the ITK filter built by filterInternal().
+  */
+  void filterSliceBySlice();
+
   /**
    * @brief Initializes all the private instance variables.
    */
@@ -434,8 +1068,29 @@ protected:
 private:
   DEFINE_IDATAARRAY_VARIABLE(NewCellArray)
 
+  unsigned int m_StreamDivisions;
+  unsigned int m_Threads;
+  IDataArray::Pointer m_StreamedOutputArray;
+  double m_EstimatedPeakMemory;
+  const void* m_InputBuffer;
+
+  bool m_CollectingSliceJobs;
+  std::vector<std::function<void(size_t)>> m_SliceJobs;
+  IDataArray::Pointer m_SliceOutputArray;
+  QString m_SliceInputType;
+  QString m_SliceOutputType;
+
   ITKImageBase(const ITKImageBase&);   // Copy Constructor Not Implemented
   void operator=(const ITKImageBase&) = delete; // Operator '=' Not Implemented
 };
 
+/**
+ * @brief Overload of the function declared in Dream3DTemplateAliasMacro.h: the 2D version of the filter
+ * is also run on 3D images whose slices are processed independently.
+ */
+inline bool Dream3DUse2DImage(const ITKImageBase* filter, const QVector<size_t>& tDims)
+{
+  return tDims[2] == 1 || filter->getSliceBySlice();
+}
+
 #endif /* _ITKImageBase_H_ */
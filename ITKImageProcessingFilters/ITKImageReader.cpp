@@ -35,7 +35,9 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
@@ -45,6 +47,222 @@
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessingPlugin.h"
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSysInfo>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Resolves the data file named in a header relatively to the header
+// -----------------------------------------------------------------------------
+QString DataFilePath(const QString& headerFileName, const QByteArray& dataFileName)
+{
+  const QString dataFile = QString::fromLocal8Bit(dataFileName);
+  if(QFileInfo(dataFile).isAbsolute())
+  {
+    return dataFile;
+  }
+  return QFileInfo(headerFileName).absoluteDir().filePath(dataFile);
+}
+
+// -----------------------------------------------------------------------------
+// MetaImage (.mha/.mhd): "Key = Value" lines, ElementDataFile is the last one.
+// -----------------------------------------------------------------------------
+bool LocateMetaImagePayload(const QString& fileName, qint64 payloadSize, QString& dataFileName, qint64& offset)
+{
+  QFile file(fileName);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  bool compressed = false;
+  bool bigEndian = false;
+  qint64 headerSize = 0;
+  QByteArray elementDataFile;
+  while(!file.atEnd() && file.pos() < 65536 && elementDataFile.isEmpty())
+  {
+    const QByteArray line = file.readLine();
+    const int separator = line.indexOf('=');
+    if(separator < 0)
+    {
+      continue;
+    }
+    const QByteArray key = line.left(separator).trimmed();
+    const QByteArray value = line.mid(separator + 1).trimmed();
+    if(key == "CompressedData")
+    {
+      compressed = (value.toLower() == "true");
+    }
+    else if(key == "BinaryDataByteOrderMSB" || key == "ElementByteOrderMSB")
+    {
+      bigEndian = (value.toLower() == "true");
+    }
+    else if(key == "HeaderSize")
+    {
+      headerSize = value.toLongLong();
+    }
+    else if(key == "ElementDataFile")
+    {
+      elementDataFile = value;
+    }
+  }
+  if(elementDataFile.isEmpty() || compressed || bigEndian != (QSysInfo::ByteOrder == QSysInfo::BigEndian))
+  {
+    return false;
+  }
+  if(elementDataFile == "LOCAL")
+  {
+    // The pixels follow the header
+    dataFileName = fileName;
+    offset = file.pos();
+    return true;
+  }
+  if(elementDataFile.startsWith("LIST") || elementDataFile.contains('%') || elementDataFile.contains(' '))
+  {
+    // One file per slice
+    return false;
+  }
+  dataFileName = DataFilePath(fileName, elementDataFile);
+  offset = (headerSize < 0 ? QFileInfo(dataFileName).size() - payloadSize : headerSize);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// NRRD (.nrrd/.nhdr): "key: value" lines up to an empty line, raw encoding only.
+// -----------------------------------------------------------------------------
+bool LocateNrrdPayload(const QString& fileName, qint64 payloadSize, QString& dataFileName, qint64& offset)
+{
+  QFile file(fileName);
+  if(!file.open(QIODevice::ReadOnly) || !file.readLine().startsWith("NRRD000"))
+  {
+    return false;
+  }
+  QByteArray encoding;
+  QByteArray endian;
+  QByteArray dataFile;
+  qint64 byteSkip = 0;
+  qint64 lineSkip = 0;
+  while(!file.atEnd() && file.pos() < 65536)
+  {
+    const QByteArray line = file.readLine().trimmed();
+    if(line.isEmpty())
+    {
+      break;
+    }
+    const int separator = line.indexOf(':');
+    if(line.startsWith('#') || separator < 0 || line.mid(separator, 2) == ":=")
+    {
+      continue;
+    }
+    const QByteArray key = line.left(separator).trimmed().replace(" ", "");
+    const QByteArray value = line.mid(separator + 1).trimmed();
+    if(key == "encoding")
+    {
+      encoding = value;
+    }
+    else if(key == "endian")
+    {
+      endian = value;
+    }
+    else if(key == "datafile")
+    {
+      dataFile = value;
+    }
+    else if(key == "byteskip")
+    {
+      byteSkip = value.toLongLong();
+    }
+    else if(key == "lineskip")
+    {
+      lineSkip = value.toLongLong();
+    }
+  }
+  const bool bigEndian = (QSysInfo::ByteOrder == QSysInfo::BigEndian);
+  if(encoding != "raw" || lineSkip != 0 || (!endian.isEmpty() && endian != (bigEndian ? "big" : "little")))
+  {
+    return false;
+  }
+  if(dataFile.isEmpty())
+  {
+    // The pixels follow the header
+    dataFileName = fileName;
+    offset = (byteSkip < 0 ? file.size() - payloadSize : file.pos() + byteSkip);
+    return true;
+  }
+  if(dataFile.startsWith("LIST") || dataFile.contains('%') || dataFile.contains(' '))
+  {
+    // One file per slice
+    return false;
+  }
+  dataFileName = DataFilePath(fileName, dataFile);
+  offset = (byteSkip < 0 ? QFileInfo(dataFileName).size() - payloadSize : byteSkip);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// MRC: 1024 byte header followed by an extended header of NSYMBT bytes.
+// -----------------------------------------------------------------------------
+bool LocateMRCPayload(const QString& fileName, QString& dataFileName, qint64& offset)
+{
+  QFile file(fileName);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  const QByteArray header = file.read(1024);
+  if(header.size() != 1024)
+  {
+    return false;
+  }
+  // Machine stamp: 0x44 0x41 or 0x44 0x44 for little endian files, 0x11 0x11 for big endian files
+  const unsigned char stamp = static_cast<unsigned char>(header[212]);
+  const bool bigEndianFile = (stamp == 0x11);
+  if((stamp != 0x44 && stamp != 0x11) || bigEndianFile != (QSysInfo::ByteOrder == QSysInfo::BigEndian))
+  {
+    return false;
+  }
+  qint32 extendedHeaderSize = 0;
+  memcpy(&extendedHeaderSize, header.constData() + 92, sizeof(extendedHeaderSize));
+  if(extendedHeaderSize < 0)
+  {
+    return false;
+  }
+  dataFileName = fileName;
+  offset = 1024 + static_cast<qint64>(extendedHeaderSize);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Finds the file and the offset of the pixels of an uncompressed MetaImage, NRRD or
+// MRC file stored in the byte order of this machine.
+// -----------------------------------------------------------------------------
+bool LocateRawPayload(const itk::ImageIOBase* imageIO, const QString& fileName, QString& dataFileName, qint64& offset)
+{
+  const qint64 payloadSize = static_cast<qint64>(imageIO->GetImageSizeInBytes());
+  const std::string ioName = imageIO->GetNameOfClass();
+  bool located = false;
+  if(ioName == "MetaImageIO")
+  {
+    located = LocateMetaImagePayload(fileName, payloadSize, dataFileName, offset);
+  }
+  else if(ioName == "NrrdImageIO")
+  {
+    located = LocateNrrdPayload(fileName, payloadSize, dataFileName, offset);
+  }
+  else if(ioName == "MRCImageIO")
+  {
+    located = LocateMRCPayload(fileName, dataFileName, offset);
+  }
+  return located && offset >= 0 && offset + payloadSize <= QFileInfo(dataFileName).size();
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -54,7 +272,20 @@ ITKImageReader::ITKImageReader()
 , m_DataContainerName(SIMPL::Defaults::ImageDataContainerName)
 , m_CellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
 , m_ImageDataArrayName(SIMPL::CellData::ImageData)
+, m_MemoryMap(false)
 {
+  m_RegionStart.x = 0;
+  m_RegionStart.y = 0;
+  m_RegionStart.z = 0;
+
+  m_RegionSize.x = 0;
+  m_RegionSize.y = 0;
+  m_RegionSize.z = 0;
+
+  m_Stride.x = 1;
+  m_Stride.y = 1;
+  m_Stride.z = 1;
+
   setupFilterParameters();
 }
 
@@ -71,6 +302,10 @@ void ITKImageReader::setupFilterParameters()
   FilterParameterVector parameters;
   QString supportedExtensions = ITKImageProcessingPlugin::getListSupportedReadExtensions();
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("File", FileName, FilterParameter::Parameter, ITKImageReader, supportedExtensions, "Image"));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Start", RegionStart, FilterParameter::Parameter, ITKImageReader));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Size (0 for the whole axis)", RegionSize, FilterParameter::Parameter, ITKImageReader));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Stride", Stride, FilterParameter::Parameter, ITKImageReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Memory Map Uncompressed Files", MemoryMap, FilterParameter::Parameter, ITKImageReader));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ITKImageReader));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ITKImageReader));
@@ -86,6 +321,10 @@ void ITKImageReader::readFilterParameters(AbstractFilterParametersReader* reader
   reader->openFilterGroup(this, index);
   setFileName(reader->readString("FileName", getFileName()));
   setDataContainerName(reader->readString("DataContainerName", getDataContainerName()));
+  setRegionStart(reader->readIntVec3("RegionStart", getRegionStart()));
+  setRegionSize(reader->readIntVec3("RegionSize", getRegionSize()));
+  setStride(reader->readIntVec3("Stride", getStride()));
+  setMemoryMap(reader->readValue("MemoryMap", getMemoryMap()));
   reader->closeFilterGroup();
 }
 
@@ -148,30 +387,31 @@ void ITKImageReader::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TComponent> void ITKImageReader::readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, bool dataCheck)
+template <typename TComponent> void ITKImageReader::readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck)
 {
   const unsigned int dimensions = imageIO->GetNumberOfDimensions();
   switch(dimensions)
   {
   case 1:
   {
-    readImage<TComponent, 1>(imageIO, filename, dataCheck);
+    readImage<TComponent, 1>(imageIO, filename, region, dataCheck);
     break;
   }
   case 2:
   {
-    readImage<TComponent, 2>(imageIO, filename, dataCheck);
+    readImage<TComponent, 2>(imageIO, filename, region, dataCheck);
     break;
   }
   default:
   {
-    readImage<TComponent, 3>(imageIO, filename, dataCheck);
+    readImage<TComponent, 3>(imageIO, filename, region, dataCheck);
     break;
   }
   }
 }
 
-template <typename TComponent, unsigned int dimensions> void ITKImageReader::readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, bool dataCheck)
+template <typename TComponent, unsigned int dimensions>
+void ITKImageReader::readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck)
 {
   typedef itk::ImageIOBase::IOPixelType PixelTypeType;
   PixelTypeType pixel = imageIO->GetPixelType();
@@ -179,26 +419,26 @@ template <typename TComponent, unsigned int dimensions> void ITKImageReader::rea
   switch(pixel)
   {
   case itk::ImageIOBase::SCALAR:
-    readImage<TComponent, dimensions>(filename, dataCheck);
+    readImage<TComponent, dimensions>(imageIO, filename, region, dataCheck);
     break;
   case itk::ImageIOBase::RGBA:
-    readImage<itk::RGBAPixel<TComponent>, dimensions>(filename, dataCheck);
+    readImage<itk::RGBAPixel<TComponent>, dimensions>(imageIO, filename, region, dataCheck);
     break;
   case itk::ImageIOBase::RGB:
-    readImage<itk::RGBPixel<TComponent>, dimensions>(filename, dataCheck);
+    readImage<itk::RGBPixel<TComponent>, dimensions>(imageIO, filename, region, dataCheck);
     break;
   case itk::ImageIOBase::VECTOR:
     if(nbComponents == 2)
     {
-      readImage<itk::Vector<TComponent, 2>, dimensions>(filename, dataCheck);
+      readImage<itk::Vector<TComponent, 2>, dimensions>(imageIO, filename, region, dataCheck);
     }
     else if(nbComponents == 3)
     {
-      readImage<itk::Vector<TComponent, 3>, dimensions>(filename, dataCheck);
+      readImage<itk::Vector<TComponent, 3>, dimensions>(imageIO, filename, region, dataCheck);
     }
     else if(nbComponents == 36)
     {
-      readImage<itk::Vector<TComponent, 36>, dimensions>(filename, dataCheck);
+      readImage<itk::Vector<TComponent, 36>, dimensions>(imageIO, filename, region, dataCheck);
     }
     else
     {
@@ -228,7 +468,8 @@ template <typename TComponent, unsigned int dimensions> void ITKImageReader::rea
 //
 // -----------------------------------------------------------------------------
 template <typename TPixel, unsigned int dimensions>
-void ITKImageReader::readImageOutputInformation(typename itk::ImageFileReader<itk::Dream3DImage<TPixel, dimensions>>::Pointer& reader, DataContainer::Pointer& container)
+void ITKImageReader::readImageOutputInformation(typename itk::ImageFileReader<itk::Dream3DImage<TPixel, dimensions>>::Pointer& reader, const ITKDream3DHelper::ReadRegion& region,
+                                                DataContainer::Pointer& container)
 {
   typedef itk::Dream3DImage<TPixel, dimensions> ImageType;
   typedef typename itk::NumericTraits<TPixel>::ValueType ValueType;
@@ -242,9 +483,9 @@ void ITKImageReader::readImageOutputInformation(typename itk::ImageFileReader<it
   // Initialize torigin/tspacing/tDims since arrays are always of size 3 and ITK image may have a different size.
   for(size_t i = 0; i < dimensions; i++)
   {
-    torigin[i] = origin[i];
-    tspacing[i] = spacing[i];
-    tDims[i] = size[i];
+    torigin[i] = origin[i] + spacing[i] * region.start[i];
+    tspacing[i] = spacing[i] * region.stride[i];
+    tDims[i] = region.GetOutputSize(i);
   }
   ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
   image->setDimensions(tDims[0], tDims[1], tDims[2]);
@@ -258,6 +499,17 @@ void ITKImageReader::readImageOutputInformation(typename itk::ImageFileReader<it
   {
     return;
   }
+  size_t fileDims[3] = {1, 1, 1};
+  for(size_t i = 0; i < dimensions; i++)
+  {
+    fileDims[i] = size[i];
+  }
+  if(!getInPreflight() && region.IsFullImage(fileDims))
+  {
+    // The whole image is read into a buffer that becomes the array, or mapped: allocating the array
+    // here would only add a second copy of the image to the peak memory.
+    return;
+  }
   DataArrayPath path;
   path.update(getDataContainerName(), getCellAttributeMatrixName(), getImageDataArrayName());
   getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<ValueType>, AbstractFilter, ValueType>(this, path, 0, cDims);
@@ -266,7 +518,8 @@ void ITKImageReader::readImageOutputInformation(typename itk::ImageFileReader<it
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel, unsigned int dimensions> void ITKImageReader::readImage(const QString& filename, bool dataCheck)
+template <typename TPixel, unsigned int dimensions>
+void ITKImageReader::readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck)
 {
   DataContainer::Pointer container = getDataContainerArray()->getDataContainer(getDataContainerName());
   if(nullptr == container.get())
@@ -285,9 +538,19 @@ template <typename TPixel, unsigned int dimensions> void ITKImageReader::readIma
 
   if(dataCheck)
   {
-    readImageOutputInformation<TPixel, dimensions>(reader, container);
+    readImageOutputInformation<TPixel, dimensions>(reader, region, container);
+    return;
   }
-  else
+  size_t fileDims[3] = {1, 1, 1};
+  for(unsigned int i = 0; i < std::min(3u, imageIO->GetNumberOfDimensions()); i++)
+  {
+    fileDims[i] = imageIO->GetDimensions(i);
+  }
+  if(!region.IsFullImage(fileDims))
+  {
+    readImageRegion<TPixel>(imageIO, region);
+  }
+  else if(!m_MemoryMap || !mapImage<TPixel>(imageIO, filename, container))
   {
     typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
     toDream3DFilter->SetInput(reader->GetOutput());
@@ -299,6 +562,106 @@ template <typename TPixel, unsigned int dimensions> void ITKImageReader::readIma
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> bool ITKImageReader::mapImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, DataContainer::Pointer& container)
+{
+  typedef typename itk::NumericTraits<TPixel>::ValueType ValueType;
+  QString dataFileName;
+  qint64 offset = 0;
+  QString reason;
+  std::shared_ptr<QFile> file(new QFile());
+  uchar* memory = nullptr;
+  if(!LocateRawPayload(imageIO, filename, dataFileName, offset))
+  {
+    reason = "it is not an uncompressed MetaImage, NRRD or MRC file in the byte order of this computer";
+  }
+  else if(offset % sizeof(ValueType) != 0)
+  {
+    reason = QString("its pixels start at byte %1, which is not aligned on their size").arg(offset);
+  }
+  else
+  {
+    file->setFileName(dataFileName);
+    if(file->open(QIODevice::ReadOnly))
+    {
+      // Private mapping: filters may modify the array, the changes are never written to the file
+      memory = file->map(offset, static_cast<qint64>(imageIO->GetImageSizeInBytes()), QFileDevice::MapPrivateOption);
+    }
+    if(nullptr == memory)
+    {
+      reason = QString("mapping \"%1\" failed: %2").arg(dataFileName).arg(file->errorString());
+    }
+  }
+  if(nullptr == memory)
+  {
+    setWarningCondition(-8);
+    QString warningMessage = QString("\"%1\" is read into memory instead of being memory mapped: %2.").arg(filename).arg(reason);
+    notifyWarningMessage(getHumanLabel(), warningMessage, getWarningCondition());
+    return false;
+  }
+
+  QVector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<TPixel>();
+  ImageGeom::Pointer imageGeom = std::dynamic_pointer_cast<ImageGeom>(container->getGeometry());
+  AttributeMatrix::Pointer attrMat = container->getAttributeMatrix(m_CellAttributeMatrixName);
+  if(nullptr == imageGeom.get() || nullptr == attrMat.get())
+  {
+    setErrorCondition(-9);
+    notifyErrorMessage(getHumanLabel(), "The geometry and the cell attribute matrix must be created before the image is mapped.", getErrorCondition());
+    return true;
+  }
+  // The array does not own the mapped memory: the deleter of the pointer added to the attribute
+  // matrix deletes the array, then closes the file, which unmaps the memory
+  typename DataArray<ValueType>::Pointer wrapped =
+      DataArray<ValueType>::WrapPointer(reinterpret_cast<ValueType*>(memory), imageGeom->getNumberOfElements(), cDims, m_ImageDataArrayName, false);
+  typename DataArray<ValueType>::Pointer data(wrapped.get(), [wrapped, file](DataArray<ValueType>*) mutable {
+    wrapped.reset();
+    file->close();
+  });
+  wrapped.reset();
+  attrMat->addAttributeArray(m_ImageDataArrayName, data);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> void ITKImageReader::readImageRegion(const itk::ImageIOBase::Pointer& imageIO, const ITKDream3DHelper::ReadRegion& region)
+{
+  typedef typename itk::NumericTraits<TPixel>::ValueType ValueType;
+  QVector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<TPixel>();
+  DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), getImageDataArrayName());
+  typename DataArray<ValueType>::Pointer imageData = getDataContainerArray()->getPrereqArrayFromPath<DataArray<ValueType>, AbstractFilter>(this, path, cDims);
+  if(getErrorCondition() < 0 || nullptr == imageData.get())
+  {
+    return;
+  }
+  const size_t numberOfComponents = static_cast<size_t>(imageData->getNumberOfComponents());
+  std::vector<ValueType> buffer;
+  const itk::ImageIORegion requested = ITKDream3DHelper::GetRequestedIORegion(imageIO, region);
+  if(region.stride[2] == 1 || ITKDream3DHelper::GetStreamableIORegion(imageIO, requested) != requested)
+  {
+    // Whole region at once. Formats that cannot stream decode the whole file only once this way.
+    ITKDream3DHelper::ReadRegionFromIO<ValueType>(imageIO, region, numberOfComponents, buffer, imageData->getPointer(0));
+    return;
+  }
+  // The format streams: only the slices that are kept are decoded
+  const size_t sliceSize = region.GetOutputSize(0) * region.GetOutputSize(1) * numberOfComponents;
+  ITKDream3DHelper::ReadRegion sliceRegion = region;
+  sliceRegion.size[2] = 1;
+  sliceRegion.stride[2] = 1;
+  for(size_t z = 0; z < region.GetOutputSize(2); z++)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    sliceRegion.start[2] = region.start[2] + z * region.stride[2];
+    ITKDream3DHelper::ReadRegionFromIO<ValueType>(imageIO, sliceRegion, numberOfComponents, buffer, imageData->getPointer(z * sliceSize));
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -318,39 +681,53 @@ void ITKImageReader::readImage(bool dataCheck)
     imageIO->SetFileName(filename.toLatin1());
     imageIO->ReadImageInformation();
 
+    size_t fileDims[3] = {1, 1, 1};
+    for(unsigned int i = 0; i < std::min(3u, imageIO->GetNumberOfDimensions()); i++)
+    {
+      fileDims[i] = imageIO->GetDimensions(i);
+    }
+    ITKDream3DHelper::ReadRegion region;
+    QString regionError;
+    if(!ITKDream3DHelper::ComputeReadRegion(m_RegionStart, m_RegionSize, m_Stride, fileDims, region, regionError))
+    {
+      setErrorCondition(-6);
+      notifyErrorMessage(getHumanLabel(), regionError, getErrorCondition());
+      return;
+    }
+
     typedef itk::ImageIOBase::IOComponentType ComponentType;
     const ComponentType component = imageIO->GetComponentType();
     switch(component)
     {
     case itk::ImageIOBase::UCHAR:
-      readImage<unsigned char>(imageIO, filename, dataCheck);
+      readImage<unsigned char>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::CHAR:
-      readImage<char>(imageIO, filename, dataCheck);
+      readImage<char>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::USHORT:
-      readImage<unsigned short>(imageIO, filename, dataCheck);
+      readImage<unsigned short>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::SHORT:
-      readImage<short>(imageIO, filename, dataCheck);
+      readImage<short>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::UINT:
-      readImage<unsigned int>(imageIO, filename, dataCheck);
+      readImage<unsigned int>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::INT:
-      readImage<int>(imageIO, filename, dataCheck);
+      readImage<int>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::ULONG:
-      readImage<unsigned long>(imageIO, filename, dataCheck);
+      readImage<unsigned long>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::LONG:
-      readImage<long>(imageIO, filename, dataCheck);
+      readImage<long>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::FLOAT:
-      readImage<float>(imageIO, filename, dataCheck);
+      readImage<float>(imageIO, filename, region, dataCheck);
       break;
     case itk::ImageIOBase::DOUBLE:
-      readImage<double>(imageIO, filename, dataCheck);
+      readImage<double>(imageIO, filename, region, dataCheck);
       break;
     default:
       setErrorCondition(-4);
@@ -35,6 +35,7 @@
 #define _ITKImageReader_H_
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/SIMPLib.h"
@@ -42,6 +43,7 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkReadRegion.h"
 
 #include <itkImageFileReader.h>
 
@@ -70,6 +72,19 @@ public:
 
   SIMPL_FILTER_PARAMETER(QString, ImageDataArrayName)
   Q_PROPERTY(QString ImageDataArrayName READ getImageDataArrayName WRITE setImageDataArrayName)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, RegionStart)
+  Q_PROPERTY(IntVec3_t RegionStart READ getRegionStart WRITE setRegionStart)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, RegionSize)
+  Q_PROPERTY(IntVec3_t RegionSize READ getRegionSize WRITE setRegionSize)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, Stride)
+  Q_PROPERTY(IntVec3_t Stride READ getStride WRITE setStride)
+
+  SIMPL_FILTER_PARAMETER(bool, MemoryMap)
+  Q_PROPERTY(bool MemoryMap READ getMemoryMap WRITE setMemoryMap)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -173,16 +188,35 @@ protected:
   /**
   * @brief Does the actual reading of the image with itkImageFileReader.
   */
-  template <typename TComponent> void readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, bool dataCheck);
-  template <typename TComponent, unsigned int dimensions> void readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, bool dataCheck);
-  template <typename TPixel, unsigned int> void readImage(const QString& filename, bool dataCheck);
+  template <typename TComponent> void readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck);
+  template <typename TComponent, unsigned int dimensions>
+  void readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck);
+  template <typename TPixel, unsigned int>
+  void readImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, const ITKDream3DHelper::ReadRegion& region, bool dataCheck);
   void readImage(bool dataCheck);
 
   /**
   * @brief Reads image size, spacing and origin, and updates container information accordingly.
+  * The geometry is the one of the region: its origin is the first pixel read and its resolution
+  * is scaled by the stride.
   */
   template <typename TPixel, unsigned int dimensions>
-  void readImageOutputInformation(typename itk::ImageFileReader<itk::Dream3DImage<TPixel, dimensions>>::Pointer& reader, DataContainer::Pointer& container);
+  void readImageOutputInformation(typename itk::ImageFileReader<itk::Dream3DImage<TPixel, dimensions>>::Pointer& reader, const ITKDream3DHelper::ReadRegion& region,
+                                  DataContainer::Pointer& container);
+
+  /**
+  * @brief Maps the pixels of an uncompressed MetaImage, NRRD or MRC file as the image data array,
+  * which does not own them. Pages are then read on demand from the file and can be reclaimed by
+  * the system. Returns false, after a warning, if the file cannot be mapped.
+  */
+  template <typename TPixel> bool mapImage(const itk::ImageIOBase::Pointer& imageIO, const QString& filename, DataContainer::Pointer& container);
+
+  /**
+  * @brief Reads a region of the image directly with the ImageIO, which only decodes the requested
+  * part of the file when the format supports streaming. Slices are requested one at a time when
+  * skipping some of them along Z.
+  */
+  template <typename TPixel> void readImageRegion(const itk::ImageIOBase::Pointer& imageIO, const ITKDream3DHelper::ReadRegion& region);
 
 private:
   ITKImageReader(const ITKImageReader&) = delete; // Copy Constructor Not Implemented
@@ -34,15 +34,20 @@
 #include "ITKImageWriter.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QMap>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkChunkedVolumeImageIO.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkInPlaceDream3DDataToImageFilter.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessingPlugin.h"
@@ -56,10 +61,268 @@ extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
 
 // ITK includes
 #include <itkImageFileWriter.h>
-#include <itkImageSeriesWriter.h>
+#include <itkImageIOFactory.h>
+#include <itkMultiThreader.h>
 #include <itkNumericSeriesFileNames.h>
+#include <itkPNGImageIO.h>
+#include <itkTIFFImageIO.h>
 #include <itksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace
+{
+/**
+ * @brief The BackgroundWrites class keeps track of the writes running in background by output
+ * file, so that a new write to a file waits for the previous one, and keeps the errors of the
+ * writes that failed until they are reported.
+ */
+class BackgroundWrites
+{
+public:
+  static BackgroundWrites& Instance()
+  {
+    static BackgroundWrites instance;
+    return instance;
+  }
+
+  /**
+   * @brief start Runs 'write' on a new thread. The write is removed from the running ones when it
+   * returns, and its error condition is kept if it is negative.
+   */
+  std::shared_future<int> start(const QString& fileName, const std::function<int()>& write)
+  {
+    // The lock is held until the write is registered: finish() cannot run before
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const size_t id = ++m_LastId;
+    std::shared_future<int> future = std::async(std::launch::async, [this, fileName, id, write]() {
+                                       const int error = write();
+                                       finish(fileName, id, error);
+                                       return error;
+                                     }).share();
+    m_Writes[fileName] = qMakePair(id, future);
+    return future;
+  }
+
+  /**
+   * @brief wait Waits for the last write to 'fileName' running in background and returns its
+   * error condition if it failed and was not reported yet, or 0.
+   */
+  int wait(const QString& fileName)
+  {
+    std::shared_future<int> write;
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      QMap<QString, QPair<size_t, std::shared_future<int>>>::iterator it = m_Writes.find(fileName);
+      if(it != m_Writes.end())
+      {
+        write = it.value().second;
+      }
+    }
+    if(write.valid())
+    {
+      write.wait();
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Errors.take(fileName);
+  }
+
+  /**
+   * @brief waitAll Waits for all the writes running in background and returns the error
+   * conditions of the ones that failed and were not reported yet, by file name.
+   */
+  QMap<QString, int> waitAll()
+  {
+    QList<std::shared_future<int>> writes;
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      for(QMap<QString, QPair<size_t, std::shared_future<int>>>::iterator it = m_Writes.begin(); it != m_Writes.end(); ++it)
+      {
+        writes.push_back(it.value().second);
+      }
+    }
+    for(QList<std::shared_future<int>>::iterator it = writes.begin(); it != writes.end(); ++it)
+    {
+      it->wait();
+    }
+    QMap<QString, int> errors;
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    errors.swap(m_Errors);
+    return errors;
+  }
+
+  /**
+   * @brief clearErrors Forgets the errors of the writes that failed. Called when a pipeline starts:
+   * the writers of the previous runs report their own errors.
+   */
+  void clearErrors()
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Errors.clear();
+  }
+
+private:
+  void finish(const QString& fileName, size_t id, int error)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    QMap<QString, QPair<size_t, std::shared_future<int>>>::iterator it = m_Writes.find(fileName);
+    if(it != m_Writes.end() && it.value().first == id)
+    {
+      m_Writes.erase(it);
+    }
+    if(error < 0)
+    {
+      m_Errors[fileName] = error;
+    }
+  }
+
+  std::mutex m_Mutex;
+  size_t m_LastId = 0;
+  QMap<QString, QPair<size_t, std::shared_future<int>>> m_Writes;
+  QMap<QString, int> m_Errors;
+};
+
+/**
+ * @brief CreateImageIO Returns the ImageIO that writes 'fileName', set up with the compression
+ * parameters of the filter, or a null pointer if no ImageIO can write that file. A level of -1
+ * keeps the default level of the format and a level of 0 disables the compression. Only PNG
+ * and chunked volume files expose their compression level and only TIFF offers a choice of
+ * codec, the other formats compress with their own codec and level when the compression is
+ * enabled.
+ */
+itk::ImageIOBase::Pointer CreateImageIO(const std::string& fileName, int compressionLevel, int compressor)
+{
+  itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(fileName.c_str(), itk::ImageIOFactory::WriteMode);
+  if(nullptr == imageIO)
+  {
+    return imageIO;
+  }
+  const bool useCompression = (compressor != ITKImageWriter::NoCompressor && compressionLevel != 0);
+  imageIO->SetUseCompression(useCompression);
+  if(itk::PNGImageIO* pngIO = dynamic_cast<itk::PNGImageIO*>(imageIO.GetPointer()))
+  {
+    if(compressionLevel > 0)
+    {
+      pngIO->SetCompressionLevel(compressionLevel);
+    }
+  }
+  else if(itk::ChunkedVolumeImageIO* chunkedIO = dynamic_cast<itk::ChunkedVolumeImageIO*>(imageIO.GetPointer()))
+  {
+    if(compressionLevel > 0)
+    {
+      chunkedIO->SetCompressionLevel(compressionLevel);
+    }
+  }
+  else if(itk::TIFFImageIO* tiffIO = dynamic_cast<itk::TIFFImageIO*>(imageIO.GetPointer()))
+  {
+    // TIFFImageIO ignores UseCompression: the codec has to be set explicitly
+    if(!useCompression)
+    {
+      tiffIO->SetCompressionToNoCompression();
+    }
+    else if(compressor == ITKImageWriter::DeflateCompressor)
+    {
+      tiffIO->SetCompressionToDeflate();
+    }
+    else if(compressor == ITKImageWriter::LZWCompressor)
+    {
+      tiffIO->SetCompressionToLZW();
+    }
+    else if(compressor == ITKImageWriter::PackBitsCompressor)
+    {
+      tiffIO->SetCompressionToPackBits();
+    }
+  }
+  return imageIO;
+}
+
+/**
+ * @brief The SliceWriterData struct is shared by the threads that write the slices of a stack.
+ * Slices are handed out one at a time through 'nextSlice'.
+ */
+template <typename TPixel> struct SliceWriterData
+{
+  AbstractFilter* filter;
+  const std::vector<std::string>* fileNames;
+  int compressionLevel;
+  int compressor;
+  TPixel* buffer;
+  itk::Size<2> sliceSize;
+  itk::Vector<double, 2> spacing;
+  itk::Point<double, 2> origin;
+  std::atomic<int> nextSlice;
+  std::atomic<int> completedSlices;
+  std::atomic<bool> abort;
+  std::mutex errorMutex;
+  int errorCondition;
+  QString errorMessage;
+
+  void setError(int code, const QString& message)
+  {
+    std::lock_guard<std::mutex> lock(errorMutex);
+    if(errorCondition == 0)
+    {
+      errorCondition = code;
+      errorMessage = message;
+    }
+    abort = true;
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> ITK_THREAD_RETURN_TYPE WriteSlicesThreaderCallback(void* arg)
+{
+  typedef itk::MultiThreader::ThreadInfoStruct ThreadInfoType;
+  typedef itk::Image<TPixel, 2> SliceType;
+  typedef itk::ImageFileWriter<SliceType> WriterType;
+
+  ThreadInfoType* info = static_cast<ThreadInfoType*>(arg);
+  SliceWriterData<TPixel>* data = static_cast<SliceWriterData<TPixel>*>(info->UserData);
+  const int numberOfSlices = static_cast<int>(data->fileNames->size());
+  const size_t numberOfPixels = data->sliceSize[0] * data->sliceSize[1];
+  for(int z = data->nextSlice++; z < numberOfSlices && !data->abort; z = data->nextSlice++)
+  {
+    try
+    {
+      // The slice is a view of the 3D buffer, it does not own nor copy the pixels
+      typename SliceType::Pointer slice = SliceType::New();
+      slice->SetRegions(data->sliceSize);
+      slice->SetSpacing(data->spacing);
+      slice->SetOrigin(data->origin);
+      slice->GetPixelContainer()->SetImportPointer(data->buffer + static_cast<size_t>(z) * numberOfPixels, numberOfPixels, false);
+      typename WriterType::Pointer writer = WriterType::New();
+      writer->SetInput(slice);
+      writer->SetFileName((*data->fileNames)[z]);
+      writer->SetImageIO(CreateImageIO((*data->fileNames)[z], data->compressionLevel, data->compressor));
+      writer->SetUseCompression(writer->GetImageIO() == nullptr || writer->GetImageIO()->GetUseCompression());
+      writer->Update();
+    } catch(itk::ExceptionObject& err)
+    {
+      data->setError(-21011, QString("ITK exception was thrown while writing output file: %1").arg(err.GetDescription()));
+      break;
+    }
+    const int completed = ++data->completedSlices;
+    // Thread 0 runs in the calling thread: it is the only one talking to the filter
+    if(info->ThreadID == 0)
+    {
+      if(data->filter->getCancel())
+      {
+        data->abort = true;
+        break;
+      }
+      data->filter->notifyProgressMessage(data->filter->getMessagePrefix(), data->filter->getHumanLabel(), QString("Writing slice %1/%2").arg(completed).arg(numberOfSlices),
+                                          static_cast<int>(100 * completed / numberOfSlices));
+    }
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -67,6 +330,11 @@ ITKImageWriter::ITKImageWriter()
 : AbstractFilter()
 , m_FileName("")
 , m_ImageArrayPath("", "", "")
+, m_NumberOfThreads(0)
+, m_CompressionLevel(-1)
+, m_Compressor(DefaultCompressor)
+, m_WriteInBackground(false)
+, m_IsBackgroundWriter(false)
 {
   setupFilterParameters();
 }
@@ -74,7 +342,10 @@ ITKImageWriter::ITKImageWriter()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ITKImageWriter::~ITKImageWriter() = default;
+ITKImageWriter::~ITKImageWriter()
+{
+  waitForBackgroundWrite();
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -91,6 +362,26 @@ void ITKImageWriter::setupFilterParameters()
         DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Image", ImageArrayPath, FilterParameter::RequiredArray, ITKImageWriter, req));
   }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number Of Threads", NumberOfThreads, FilterParameter::Parameter, ITKImageWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level", CompressionLevel, FilterParameter::Parameter, ITKImageWriter));
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Compressor");
+    parameter->setPropertyName("Compressor");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKImageWriter, this, Compressor));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKImageWriter, this, Compressor));
+
+    QVector<QString> choices;
+    choices.push_back("Default");
+    choices.push_back("None");
+    choices.push_back("Deflate");
+    choices.push_back("LZW (TIFF)");
+    choices.push_back("PackBits (TIFF)");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write In Background", WriteInBackground, FilterParameter::Parameter, ITKImageWriter));
   setFilterParameters(parameters);
 }
 
@@ -102,6 +393,10 @@ void ITKImageWriter::readFilterParameters(AbstractFilterParametersReader* reader
   reader->openFilterGroup(this, index);
   setFileName(reader->readString("FileName", getFileName()));
   setImageArrayPath(reader->readDataArrayPath("ImageArrayPath", getImageArrayPath()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setCompressor(reader->readValue("Compressor", getCompressor()));
+  setWriteInBackground(reader->readValue("WriteInBackground", getWriteInBackground()));
   reader->closeFilterGroup();
 }
 
@@ -138,6 +433,32 @@ void ITKImageWriter::dataCheck()
     notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
   }
 
+  if(getNumberOfThreads() < 0)
+  {
+    setErrorCondition(-21013);
+    notifyErrorMessage(getHumanLabel(), "The number of threads must be positive, or 0 to use the default number of threads.", getErrorCondition());
+    return;
+  }
+
+  if(getCompressionLevel() < -1 || getCompressionLevel() > 9)
+  {
+    setErrorCondition(-21014);
+    notifyErrorMessage(getHumanLabel(), "The compression level must be between 0 and 9, or -1 to use the default level of the format.", getErrorCondition());
+    return;
+  }
+  if(getCompressor() < DefaultCompressor || getCompressor() > PackBitsCompressor)
+  {
+    setErrorCondition(-21016);
+    notifyErrorMessage(getHumanLabel(), "Invalid compressor.", getErrorCondition());
+    return;
+  }
+  if((getCompressor() == LZWCompressor || getCompressor() == PackBitsCompressor) && !isTIFFFormat())
+  {
+    setWarningCondition(-21017);
+    QString ss = QObject::tr("LZW and PackBits are only available for TIFF files. The default compression of the format will be used");
+    notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+  }
+
   DataContainerArray::Pointer containerArray = getDataContainerArray();
   if(!containerArray)
   {
@@ -215,6 +536,15 @@ bool ITKImageWriter::is2DFormat()
   return false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageWriter::isTIFFFormat()
+{
+  QString Ext = itksys::SystemTools::LowerCase(itksys::SystemTools::GetFilenameExtension(getFileName().toStdString())).c_str();
+  return Ext.endsWith(".tif") || Ext.endsWith(".tiff");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -230,14 +560,39 @@ template <typename TPixel, unsigned int Dimensions> void ITKImageWriter::writeAs
   namesGenerator->SetIncrementIndex(1);
   namesGenerator->SetStartIndex(0);
   namesGenerator->SetEndIndex(z_size - 1);
-  typedef itk::Dream3DImage<TPixel, Dimensions> InputImageType;
-  typedef itk::Dream3DImage<TPixel, Dimensions - 1> OutputImageType;
-  typedef itk::ImageSeriesWriter<InputImageType, OutputImageType> SeriesWriterType;
-  typename SeriesWriterType::Pointer writer = SeriesWriterType::New();
-  writer->SetInput(image);
-  writer->SetFileNames(namesGenerator->GetFileNames());
-  writer->UseCompressionOn();
-  writer->Update();
+  const std::vector<std::string> fileNames = namesGenerator->GetFileNames();
+
+  SliceWriterData<TPixel> data;
+  data.filter = this;
+  data.fileNames = &fileNames;
+  data.compressionLevel = m_CompressionLevel;
+  data.compressor = m_Compressor;
+  data.buffer = image->GetBufferPointer();
+  const typename itk::Dream3DImage<TPixel, Dimensions>::SizeType size = image->GetLargestPossibleRegion().GetSize();
+  for(unsigned int i = 0; i < 2; i++)
+  {
+    data.sliceSize[i] = size[i];
+    data.spacing[i] = image->GetSpacing()[i];
+    data.origin[i] = image->GetOrigin()[i];
+  }
+  data.nextSlice = 0;
+  data.completedSlices = 0;
+  data.abort = false;
+  data.errorCondition = 0;
+
+  // The global maximum set in the plugin settings still applies
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  const int numberOfSlices = static_cast<int>(fileNames.size());
+  const int numberOfThreads = (m_NumberOfThreads > 0 ? m_NumberOfThreads : static_cast<int>(itk::MultiThreader::GetGlobalDefaultNumberOfThreads()));
+  threader->SetNumberOfThreads(std::max(1, std::min(numberOfThreads, numberOfSlices)));
+  threader->SetSingleMethod(WriteSlicesThreaderCallback<TPixel>, &data);
+  threader->SingleMethodExecute();
+
+  if(data.errorCondition < 0)
+  {
+    setErrorCondition(data.errorCondition);
+    notifyErrorMessage(getHumanLabel(), data.errorMessage, getErrorCondition());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -250,7 +605,8 @@ template <typename TPixel, unsigned int Dimensions> void ITKImageWriter::writeAs
   typename FileWriterType::Pointer writer = FileWriterType::New();
   writer->SetInput(image);
   writer->SetFileName(getFileName().toStdString().c_str());
-  writer->UseCompressionOn();
+  writer->SetImageIO(CreateImageIO(getFileName().toStdString(), m_CompressionLevel, m_Compressor));
+  writer->SetUseCompression(writer->GetImageIO() == nullptr || writer->GetImageIO()->GetUseCompression());
   writer->Update();
 }
 
@@ -309,9 +665,33 @@ void ITKImageWriter::execute()
     return;
   }
 
+  // A write of the same file running in background has to be done before this one starts. The
+  // background writer itself is registered under that file: it must not wait for itself.
+  QFileInfo fi(getFileName());
+  if(!m_IsBackgroundWriter)
+  {
+    // The write started by the previous execution of this filter is reported before a new one starts
+    waitForBackgroundWrite();
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    if(isFirstWriter())
+    {
+      // The pipeline starts: the errors left by previous runs were reported by their writers
+      BackgroundWrites::Instance().clearErrors();
+    }
+    const int backgroundError = BackgroundWrites::Instance().wait(fi.absoluteFilePath());
+    if(backgroundError < 0)
+    {
+      setWarningCondition(-21020);
+      QString ss = QObject::tr("The previous write of '%1' in background failed with error %2").arg(getFileName()).arg(backgroundError);
+      notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+    }
+  }
+
   // Make sure any directory path is also available as the user may have just typed
   // in a path without actually creating the full path
-  QFileInfo fi(getFileName());
   QString parentPath = fi.path();
   QDir dir;
   if(!dir.mkpath(parentPath))
@@ -346,8 +726,112 @@ void ITKImageWriter::execute()
     notifyErrorMessage(getHumanLabel(), errorMessage.arg(path.getDataArrayName()), getErrorCondition());
     return;
   }
+  if(getWriteInBackground() && canWriteInBackground())
+  {
+    writeInBackground();
+    notifyStatusMessage(getHumanLabel(), "Writing in background");
+    return;
+  }
   Dream3DArraySwitchMacro(this->writeImage, getImageArrayPath(), -21010);
   notifyStatusMessage(getHumanLabel(), "Complete");
+  if(!m_IsBackgroundWriter && nullptr == getNextFilter().lock().get())
+  {
+    // A pipeline that ends with a writer is done when all its images are written. Each background
+    // write is reported by the writer that started it.
+    BackgroundWrites::Instance().waitAll();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageWriter::writeInBackground()
+{
+  // Snapshot of the image: downstream filters may modify the array in place while it is written
+  DataArrayPath path = getImageArrayPath();
+  DataContainer::Pointer container = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+  AttributeMatrix::Pointer attributeMatrix = container->getAttributeMatrix(path.getAttributeMatrixName());
+  ImageGeom::Pointer imageGeometry = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom, AbstractFilter>(this, path.getDataContainerName());
+  size_t dims[3];
+  float resolution[3];
+  float origin[3];
+  imageGeometry->getDimensions(dims[0], dims[1], dims[2]);
+  imageGeometry->getResolution(resolution[0], resolution[1], resolution[2]);
+  imageGeometry->getOrigin(origin[0], origin[1], origin[2]);
+  ImageGeom::Pointer snapshotGeometry = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  snapshotGeometry->setDimensions(dims[0], dims[1], dims[2]);
+  snapshotGeometry->setResolution(resolution[0], resolution[1], resolution[2]);
+  snapshotGeometry->setOrigin(origin[0], origin[1], origin[2]);
+  DataContainer::Pointer snapshotContainer = DataContainer::New(path.getDataContainerName());
+  snapshotContainer->setGeometry(snapshotGeometry);
+  AttributeMatrix::Pointer snapshotMatrix = snapshotContainer->createAndAddAttributeMatrix(attributeMatrix->getTupleDimensions(), path.getAttributeMatrixName(), attributeMatrix->getType());
+  snapshotMatrix->addAttributeArray(path.getDataArrayName(), attributeMatrix->getAttributeArray(path.getDataArrayName())->deepCopy());
+  DataContainerArray::Pointer snapshot = DataContainerArray::New();
+  snapshot->addDataContainer(snapshotContainer);
+
+  ITKImageWriter::Pointer writer = std::dynamic_pointer_cast<ITKImageWriter>(newFilterInstance(true));
+  writer->setWriteInBackground(false);
+  writer->m_IsBackgroundWriter = true;
+  writer->setDataContainerArray(snapshot);
+  // The task keeps the only reference to the snapshot, and releases it as soon as the file is written
+  m_BackgroundWrite = BackgroundWrites::Instance().start(QFileInfo(getFileName()).absoluteFilePath(), [writer]() mutable {
+    writer->execute();
+    const int error = writer->getErrorCondition();
+    writer->setDataContainerArray(DataContainerArray::NullPointer());
+    writer.reset();
+    return error;
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageWriter::canWriteInBackground()
+{
+  // Nothing runs after the last filter of the pipeline while the image would be written
+  return nullptr != getNextFilter().lock().get();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageWriter::isFirstWriter()
+{
+  for(AbstractFilter::Pointer previous = getPreviousFilter().lock(); nullptr != previous.get(); previous = previous->getPreviousFilter().lock())
+  {
+    if(nullptr != dynamic_cast<ITKImageWriter*>(previous.get()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageWriter::waitForBackgroundWrite()
+{
+  if(!m_BackgroundWrite.valid())
+  {
+    return;
+  }
+  const int backgroundError = m_BackgroundWrite.get();
+  m_BackgroundWrite = std::shared_future<int>();
+  if(backgroundError < 0)
+  {
+    setErrorCondition(backgroundError);
+    QString ss = QObject::tr("Writing '%1' in background failed").arg(getFileName());
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageWriter::WaitForBackgroundWrites()
+{
+  return BackgroundWrites::Instance().waitAll().isEmpty();
 }
 
 // -----------------------------------------------------------------------------
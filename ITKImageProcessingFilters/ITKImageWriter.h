@@ -40,6 +40,8 @@
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
 
+#include <future>
+
 /**
  * @brief The ITKImageProcessingFilter class. See [Filter documentation](@ref itkimageprocessingfilter) for details.
  */
@@ -57,6 +59,31 @@ class ITKImageWriter : public AbstractFilter
   SIMPL_FILTER_PARAMETER(DataArrayPath, ImageArrayPath)
   Q_PROPERTY(DataArrayPath ImageArrayPath READ getImageArrayPath WRITE setImageArrayPath)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfThreads)
+  Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+
+  SIMPL_FILTER_PARAMETER(int, CompressionLevel)
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+  SIMPL_FILTER_PARAMETER(int, Compressor)
+  Q_PROPERTY(int Compressor READ getCompressor WRITE setCompressor)
+
+  SIMPL_FILTER_PARAMETER(bool, WriteInBackground)
+  Q_PROPERTY(bool WriteInBackground READ getWriteInBackground WRITE setWriteInBackground)
+
+  /**
+   * @brief The CompressorType enum lists the choices of the Compressor parameter. LZW and
+   * PackBits are only available for TIFF files.
+   */
+  enum CompressorType
+  {
+    DefaultCompressor = 0,
+    NoCompressor = 1,
+    DeflateCompressor = 2,
+    LZWCompressor = 3,
+    PackBitsCompressor = 4
+  };
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -122,11 +149,29 @@ class ITKImageWriter : public AbstractFilter
   */
   bool is2DFormat();
 
+  /**
+  * @brief isTIFFFormat returns true if file name extension corresponds to a TIFF file
+  */
+  bool isTIFFFormat();
+
   /**
   * @brief preflight Reimplemented from @see AbstractFilter class
   */
   virtual void preflight() override;
 
+  /**
+  * @brief waitForBackgroundWrite Waits for the write started by the last execution of this filter
+  * in background mode, and reports its error if it failed. The next execution and the destructor
+  * of the filter also wait for that write and report its error.
+  */
+  void waitForBackgroundWrite();
+
+  /**
+  * @brief WaitForBackgroundWrites Waits for all the writes running in background. Returns false
+  * if any of them failed and was not reported yet.
+  */
+  static bool WaitForBackgroundWrites();
+
 signals:
   /**
    * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -168,7 +213,8 @@ protected:
   template <typename TPixel, typename UnusedTPixel, unsigned int Dimension> void writeImage();
 
   /**
-  * @brief writeAs2DStack Writes 3D images as a stack of 2D images.
+  * @brief writeAs2DStack Writes 3D images as a stack of 2D images. The slices are encoded and
+  * written concurrently, each one from a view of its part of the 3D buffer.
   */
   template <typename TPixel, unsigned int Dimensions> void writeAs2DStack(typename itk::Dream3DImage<TPixel, Dimensions>* image, unsigned long z_size);
 
@@ -177,7 +223,26 @@ protected:
   */
   template <typename TPixel, unsigned int Dimensions> void writeAsOneFile(typename itk::Dream3DImage<TPixel, Dimensions>* image);
 
+  /**
+  * @brief writeInBackground Copies the image array and its geometry, and writes the copy with a
+  * clone of this filter on a background thread. The input can be modified as soon as it returns.
+  */
+  void writeInBackground();
+
+  /**
+  * @brief canWriteInBackground Returns true if filters run after this one.
+  */
+  bool canWriteInBackground();
+
+  /**
+  * @brief isFirstWriter Returns true if no image writer runs before this one in the pipeline.
+  */
+  bool isFirstWriter();
+
 private:
+  std::shared_future<int> m_BackgroundWrite;
+  bool m_IsBackgroundWriter;
+
   ITKImageWriter(const ITKImageWriter&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKImageWriter&) = delete; // Operator '=' Not Implemented
 };
@@ -40,6 +40,8 @@
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -47,12 +49,160 @@
 #include "SIMPLib/Utilities/FilePathGenerator.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
-#include "ITKImageProcessing/ITKImageProcessingFilters/itkInPlaceImageToDream3DDataFilter.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessingPlugin.h"
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+
 #include "itksys/SystemTools.hxx"
 
+#include <itkImageFileReader.h>
+#include <itkMultiThreader.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The SliceReaderData struct is shared by the threads that decode the slices of a stack.
+ * Slices are handed out one at a time through 'nextSlice'.
+ */
+template <typename TPixel> struct SliceReaderData
+{
+  AbstractFilter* filter;
+  const QVector<QString>* fileList;
+  TPixel* buffer;
+  itk::ImageIOBase::IOComponentType componentType;
+  unsigned int numberOfComponents;
+  size_t sliceDims[2];
+  ITKDream3DHelper::ReadRegion region;
+  std::atomic<int> nextSlice;
+  std::atomic<int> completedSlices;
+  std::atomic<bool> abort;
+  std::mutex errorMutex;
+  int errorCondition;
+  QString errorMessage;
+
+  void setError(int code, const QString& message)
+  {
+    std::lock_guard<std::mutex> lock(errorMutex);
+    if(errorCondition == 0)
+    {
+      errorCondition = code;
+      errorMessage = message;
+    }
+    abort = true;
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> ITK_THREAD_RETURN_TYPE ReadSlicesThreaderCallback(void* arg)
+{
+  typedef itk::MultiThreader::ThreadInfoStruct ThreadInfoType;
+  typedef itk::Image<TPixel, 2> SliceType;
+  typedef itk::ImageFileReader<SliceType> ReaderType;
+
+  ThreadInfoType* info = static_cast<ThreadInfoType*>(arg);
+  SliceReaderData<TPixel>* data = static_cast<SliceReaderData<TPixel>*>(info->UserData);
+  const int numberOfSlices = data->fileList->size();
+  // Pixels are handled as 'numberOfComponents' interleaved values of type TPixel
+  const size_t sliceSize = data->region.GetOutputSize(0) * data->region.GetOutputSize(1) * data->numberOfComponents;
+  itk::ImageIOBase::Pointer imageIO;
+  std::vector<TPixel> buffer;
+  for(int z = data->nextSlice++; z < numberOfSlices && !data->abort; z = data->nextSlice++)
+  {
+    const QString& fileName = (*data->fileList)[z];
+    try
+    {
+      // The ImageIO is created once per thread and reused for all its slices
+      if(nullptr == imageIO)
+      {
+        imageIO = itk::ImageIOFactory::CreateImageIO(fileName.toLatin1(), itk::ImageIOFactory::ReadMode);
+        if(nullptr == imageIO)
+        {
+          data->setError(-5, QString("ITK could not read the given file \"%1\". Format is likely unsupported.").arg(fileName));
+          break;
+        }
+      }
+      imageIO->SetFileName(fileName.toLatin1());
+      imageIO->ReadImageInformation();
+      const size_t sizeX = imageIO->GetDimensions(0);
+      const size_t sizeY = (imageIO->GetNumberOfDimensions() > 1 ? imageIO->GetDimensions(1) : 1);
+      if(sizeX != data->sliceDims[0] || sizeY != data->sliceDims[1])
+      {
+        data->setError(-14, QString("Slice \"%1\" is %2x%3 pixels, the first slice is %4x%5 pixels").arg(fileName).arg(sizeX).arg(sizeY).arg(data->sliceDims[0]).arg(data->sliceDims[1]));
+        break;
+      }
+      TPixel* slice = data->buffer + static_cast<size_t>(z) * sliceSize;
+      itk::ImageIORegion largestRegion(2);
+      largestRegion.SetSize(0, sizeX);
+      largestRegion.SetSize(1, sizeY);
+      if(imageIO->GetComponentType() == data->componentType && imageIO->GetNumberOfComponents() == data->numberOfComponents && imageIO->GetNumberOfDimensions() == 2)
+      {
+        // Same pixel type as the array: decode the region straight into the slice of the array
+        ITKDream3DHelper::ReadRegionFromIO<TPixel>(imageIO, data->region, data->numberOfComponents, buffer, slice);
+      }
+      else if(data->numberOfComponents > 1)
+      {
+        // Multi-component slice with another component type: read it in its own component type and
+        // cast the components, without a reader instantiated for vector pixels
+        if(imageIO->GetNumberOfComponents() != data->numberOfComponents)
+        {
+          data->setError(-16, QString("Slice \"%1\" has %2 components per pixel, the first slice has %3").arg(fileName).arg(imageIO->GetNumberOfComponents()).arg(data->numberOfComponents));
+          break;
+        }
+        if(!ITKDream3DHelper::ReadConvertedRegionFromIO<TPixel>(imageIO, data->region, data->numberOfComponents, slice))
+        {
+          data->setError(-17, QString("Slice \"%1\" has an unsupported component type (%2)").arg(fileName).arg(QString::fromStdString(imageIO->GetComponentTypeAsString(imageIO->GetComponentType()))));
+          break;
+        }
+      }
+      else
+      {
+        // The slice needs a pixel conversion: let the ITK reader do it
+        typename ReaderType::Pointer reader = ReaderType::New();
+        reader->SetImageIO(imageIO);
+        reader->SetFileName(fileName.toStdString());
+        reader->Update();
+        const TPixel* converted = reader->GetOutput()->GetBufferPointer();
+        ITKDream3DHelper::CopyRegionSamples<TPixel>(converted, largestRegion, data->region, data->numberOfComponents, slice);
+      }
+    } catch(itk::ExceptionObject& err)
+    {
+      data->setError(-55559, QString("ITK exception was thrown while processing input file: %1").arg(err.what()));
+      break;
+    }
+    const int completed = ++data->completedSlices;
+    // Thread 0 runs in the calling thread: it is the only one talking to the filter
+    if(info->ThreadID == 0)
+    {
+      if(data->filter->getCancel())
+      {
+        data->abort = true;
+        break;
+      }
+      data->filter->notifyProgressMessage(data->filter->getMessagePrefix(), data->filter->getHumanLabel(), QString("Reading slice %1/%2").arg(completed).arg(numberOfSlices),
+                                          static_cast<int>(100 * completed / numberOfSlices));
+    }
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex ITKImportImageStack::s_SliceInformationMutex;
+QCache<QByteArray, ITKImportImageStack::SliceInformation> ITKImportImageStack::s_SliceInformationCache(64);
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -62,7 +212,20 @@ ITKImportImageStack::ITKImportImageStack()
 , m_CellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
 , m_BoundsFile("")
 , m_ImageDataArrayName(SIMPL::CellData::ImageData)
+, m_NumberOfThreads(0)
 {
+  m_RegionStart.x = 0;
+  m_RegionStart.y = 0;
+  m_RegionStart.z = 0;
+
+  m_RegionSize.x = 0;
+  m_RegionSize.y = 0;
+  m_RegionSize.z = 0;
+
+  m_Stride.x = 1;
+  m_Stride.y = 1;
+  m_Stride.z = 1;
+
   m_Origin.x = 0.0f;
   m_Origin.y = 0.0f;
   m_Origin.z = 0.0f;
@@ -93,6 +256,10 @@ void ITKImportImageStack::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FILELISTINFO_FP("Input File List", InputFileListInfo, FilterParameter::Parameter, ITKImportImageStack));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Origin", Origin, FilterParameter::Parameter, ITKImportImageStack, 0));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resolution", Resolution, FilterParameter::Parameter, ITKImportImageStack, 0));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Start", RegionStart, FilterParameter::Parameter, ITKImportImageStack));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Size (0 for the whole axis)", RegionSize, FilterParameter::Parameter, ITKImportImageStack));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Stride", Stride, FilterParameter::Parameter, ITKImportImageStack));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number Of Threads", NumberOfThreads, FilterParameter::Parameter, ITKImportImageStack));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ITKImportImageStack));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ITKImportImageStack));
@@ -112,6 +279,10 @@ void ITKImportImageStack::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
   setOrigin(reader->readFloatVec3("Origin", getOrigin()));
   setResolution(reader->readFloatVec3("Resolution", getResolution()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  setRegionStart(reader->readIntVec3("RegionStart", getRegionStart()));
+  setRegionSize(reader->readIntVec3("RegionSize", getRegionSize()));
+  setStride(reader->readIntVec3("Stride", getStride()));
   reader->closeFilterGroup();
 }
 
@@ -144,6 +315,30 @@ QVector<QString> ITKImportImageStack::getFileList()
                                              m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension, m_InputFileListInfo.PaddingDigits);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImportImageStack::findSliceInformation(const QByteArray& key, SliceInformation& information)
+{
+  QMutexLocker locker(&s_SliceInformationMutex);
+  SliceInformation* cached = s_SliceInformationCache.object(key);
+  if(nullptr == cached)
+  {
+    return false;
+  }
+  information = *cached;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImportImageStack::insertSliceInformation(const QByteArray& key, const SliceInformation& information)
+{
+  QMutexLocker locker(&s_SliceInformationMutex);
+  s_SliceInformationCache.insert(key, new SliceInformation(information));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -162,6 +357,12 @@ void ITKImportImageStack::dataCheck()
     setErrorCondition(-13);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
   }
+  if(m_NumberOfThreads < 0)
+  {
+    ss = QObject::tr("The number of threads must be positive or 0 (ITK's default)");
+    setErrorCondition(-15);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
 
   DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, getDataContainerName());
   if(getErrorCondition() < 0 || nullptr == m.get())
@@ -211,32 +412,50 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
 {
   try
   {
+    // A single stat per file: checks that it exists and builds the key of the
+    // slice information cache. The pixel data and the headers of the other
+    // slices are only read during execute.
+    QCryptographicHash hash(QCryptographicHash::Sha1);
     for(size_t fileIndex = 0; fileIndex < fileList.size(); ++fileIndex)
     {
-      const std::string fileName = fileList[fileIndex].toStdString();
-      if(!itksys::SystemTools::FileExists(fileName))
+      const QFileInfo fileInfo(fileList[fileIndex]);
+      if(!fileInfo.exists())
       {
         setErrorCondition(-7);
         QString errorMessage = "File does not exist: %1";
-        notifyErrorMessage(getHumanLabel(), errorMessage.arg(fileName.c_str()), getErrorCondition());
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(fileList[fileIndex]), getErrorCondition());
         return;
       }
+      hash.addData(fileInfo.absoluteFilePath().toUtf8());
+      hash.addData(QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch()));
     }
-    const QString filename = fileList[0];
-    itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filename.toLatin1(), itk::ImageIOFactory::ReadMode);
-    if(nullptr == imageIO)
+    const QByteArray key = hash.result();
+
+    SliceInformation information;
+    if(!findSliceInformation(key, information))
     {
-      setErrorCondition(-5);
-      QString errorMessage = "ITK could not read the given file \"%1\". Format is likely unsupported.";
-      notifyErrorMessage(getHumanLabel(), errorMessage.arg(filename), getErrorCondition());
-      return;
+      const QString filename = fileList[0];
+      itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filename.toLatin1(), itk::ImageIOFactory::ReadMode);
+      if(nullptr == imageIO)
+      {
+        setErrorCondition(-5);
+        QString errorMessage = "ITK could not read the given file \"%1\". Format is likely unsupported.";
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(filename), getErrorCondition());
+        return;
+      }
+      imageIO->SetFileName(filename.toLatin1());
+      imageIO->ReadImageInformation();
+      information.componentType = imageIO->GetComponentType();
+      information.numberOfDimensions = imageIO->GetNumberOfDimensions();
+      information.numberOfComponents = imageIO->GetNumberOfComponents();
+      information.sliceDims[0] = imageIO->GetDimensions(0);
+      information.sliceDims[1] = (information.numberOfDimensions > 1 ? imageIO->GetDimensions(1) : 1);
+      insertSliceInformation(key, information);
     }
-    imageIO->SetFileName(filename.toLatin1());
-    imageIO->ReadImageInformation();
 
     typedef itk::ImageIOBase::IOComponentType ComponentType;
-    const ComponentType type = imageIO->GetComponentType();
-    const unsigned int dimensions = imageIO->GetNumberOfDimensions();
+    const ComponentType type = information.componentType;
+    const unsigned int dimensions = information.numberOfDimensions;
     if(dimensions != 2)
     {
       setErrorCondition(-1);
@@ -245,41 +464,58 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
       return;
     }
 
+    // Z is the index of the slice in the file list: slices outside of the region or skipped by
+    // the stride are never opened.
+    const size_t stackDims[3] = {information.sliceDims[0], information.sliceDims[1], static_cast<size_t>(fileList.size())};
+    ITKDream3DHelper::ReadRegion region;
+    QString regionError;
+    if(!ITKDream3DHelper::ComputeReadRegion(m_RegionStart, m_RegionSize, m_Stride, stackDims, region, regionError))
+    {
+      setErrorCondition(-17);
+      notifyErrorMessage(getHumanLabel(), regionError, getErrorCondition());
+      return;
+    }
+    QVector<QString> regionFileList;
+    for(size_t z = 0; z < region.GetOutputSize(2); z++)
+    {
+      regionFileList.push_back(fileList[static_cast<int>(region.start[2] + z * region.stride[2])]);
+    }
+
     switch(type)
     {
     case itk::ImageIOBase::UCHAR:
-      readImageWithPixelType<unsigned char>(fileList, dataCheck);
+      readImageWithPixelType<unsigned char>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::CHAR:
-      readImageWithPixelType<char>(fileList, dataCheck);
+      readImageWithPixelType<char>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::USHORT:
-      readImageWithPixelType<unsigned short>(fileList, dataCheck);
+      readImageWithPixelType<unsigned short>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::SHORT:
-      readImageWithPixelType<short>(fileList, dataCheck);
+      readImageWithPixelType<short>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::UINT:
-      readImageWithPixelType<unsigned int>(fileList, dataCheck);
+      readImageWithPixelType<unsigned int>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::INT:
-      readImageWithPixelType<int>(fileList, dataCheck);
+      readImageWithPixelType<int>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::ULONG:
-      readImageWithPixelType<unsigned long>(fileList, dataCheck);
+      readImageWithPixelType<unsigned long>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::LONG:
-      readImageWithPixelType<long>(fileList, dataCheck);
+      readImageWithPixelType<long>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::FLOAT:
-      readImageWithPixelType<float>(fileList, dataCheck);
+      readImageWithPixelType<float>(regionFileList, information, region, dataCheck);
       break;
     case itk::ImageIOBase::DOUBLE:
-      readImageWithPixelType<double>(fileList, dataCheck);
+      readImageWithPixelType<double>(regionFileList, information, region, dataCheck);
       break;
     default:
       setErrorCondition(-4);
-      QString errorMessage = QString("Unsupported pixel type: %1.").arg(imageIO->GetComponentTypeAsString(type).c_str());
+      QString errorMessage = QString("Unsupported pixel type: %1.").arg(itk::ImageIOBase::GetComponentTypeAsString(type).c_str());
       notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
       break;
     }
@@ -295,7 +531,8 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(const QVector<QString>& fileList, bool dataCheck)
+template <typename TPixel>
+void ITKImportImageStack::readImageWithPixelType(const QVector<QString>& fileList, const SliceInformation& information, const ITKDream3DHelper::ReadRegion& region, bool dataCheck)
 {
   DataContainer::Pointer container = getDataContainerArray()->getDataContainer(getDataContainerName());
   if(nullptr == container.get())
@@ -305,43 +542,24 @@ template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(cons
     return;
   }
 
-  const unsigned int Dimension = 3;
-  typedef itk::Dream3DImage<TPixel, Dimension> ImageType;
-  typedef itk::ImageSeriesReader<ImageType> ReaderType;
-  typedef itk::InPlaceImageToDream3DDataFilter<TPixel, Dimension> ToDream3DType;
-
-  typename ReaderType::Pointer reader = ReaderType::New();
-  typename ReaderType::FileNamesContainer fileNames(fileList.size());
-  for(size_t fileIndex = 0; fileIndex < fileList.size(); ++fileIndex)
+  if(!dataCheck)
   {
-    fileNames[fileIndex] = fileList[fileIndex].toStdString();
+    // The array and the geometry have already been created by dataCheck()
+    readImageSlices<TPixel>(fileList, information, region, container);
+    return;
   }
-  reader->SetFileNames(fileNames);
 
-  if(dataCheck)
-  {
-    readImageOutputInformation<TPixel>(reader, container);
-  }
-  else
-  {
-    typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
-    toDream3DFilter->SetInput(reader->GetOutput());
-    toDream3DFilter->SetInPlace(true);
-    toDream3DFilter->SetAttributeMatrixArrayName(m_CellAttributeMatrixName.toStdString());
-    toDream3DFilter->SetDataArrayName(m_ImageDataArrayName.toStdString());
-    toDream3DFilter->SetDataContainer(container);
-    toDream3DFilter->Update();
-  }
+  QVector<size_t> tDims(3, 1);
+  tDims[0] = region.GetOutputSize(0);
+  tDims[1] = region.GetOutputSize(1);
+  tDims[2] = static_cast<size_t>(fileList.size());
+  QVector<size_t> cDims(1, information.numberOfComponents);
+  readImageOutputInformation<TPixel>(tDims, cDims, container);
 
   ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
-  image->setResolution(m_Resolution.x, m_Resolution.y, m_Resolution.z);
-  image->setOrigin(m_Origin.x, m_Origin.y, m_Origin.z);
-  const typename ImageType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
-  QVector<size_t> tDims(Dimension, 1);
-  for(unsigned int i = 0; i < Dimension; i++)
-  {
-    tDims[i] = size[i];
-  }
+  // The geometry of the region: its first pixel and the resolution scaled by the stride
+  image->setResolution(m_Resolution.x * region.stride[0], m_Resolution.y * region.stride[1], m_Resolution.z * region.stride[2]);
+  image->setOrigin(m_Origin.x + m_Resolution.x * region.start[0], m_Origin.y + m_Resolution.y * region.start[1], m_Origin.z + m_Resolution.z * region.start[2]);
   image->setDimensions(tDims[0], tDims[1], tDims[2]);
   container->setGeometry(image);
 }
@@ -349,20 +567,54 @@ template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(cons
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel> void ITKImportImageStack::readImageOutputInformation(typename itk::ImageSeriesReader<itk::Dream3DImage<TPixel, 3>>::Pointer& reader, DataContainer::Pointer& container)
+template <typename TPixel>
+void ITKImportImageStack::readImageSlices(const QVector<QString>& fileList, const SliceInformation& information, const ITKDream3DHelper::ReadRegion& region, DataContainer::Pointer& container)
 {
-  const unsigned int Dimension = 3;
-  typedef itk::Dream3DImage<TPixel, Dimension> ImageType;
+  DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), getImageDataArrayName());
+  QVector<size_t> cDims(1, information.numberOfComponents);
+  typename DataArray<TPixel>::Pointer imageData = getDataContainerArray()->getPrereqArrayFromPath<DataArray<TPixel>, AbstractFilter>(this, path, cDims);
+  if(getErrorCondition() < 0 || nullptr == imageData.get())
+  {
+    return;
+  }
 
-  reader->UpdateOutputInformation();
-  const typename ImageType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
-  QVector<size_t> tDims(Dimension, 1);
-  for(unsigned int i = 0; i < Dimension; i++)
+  SliceReaderData<TPixel> data;
+  data.filter = this;
+  data.fileList = &fileList;
+  data.buffer = imageData->getPointer(0);
+  data.componentType = information.componentType;
+  data.numberOfComponents = information.numberOfComponents;
+  data.sliceDims[0] = information.sliceDims[0];
+  data.sliceDims[1] = information.sliceDims[1];
+  // Each thread reads the X and Y extent of the region from its slices
+  data.region = region;
+  data.region.start[2] = 0;
+  data.region.size[2] = 1;
+  data.region.stride[2] = 1;
+  data.nextSlice = 0;
+  data.completedSlices = 0;
+  data.abort = false;
+  data.errorCondition = 0;
+
+  // The global maximum set in the plugin settings still applies
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  int numberOfThreads = (m_NumberOfThreads > 0 ? m_NumberOfThreads : itk::MultiThreader::GetGlobalDefaultNumberOfThreads());
+  threader->SetNumberOfThreads(std::max(1, std::min(numberOfThreads, fileList.size())));
+  threader->SetSingleMethod(ReadSlicesThreaderCallback<TPixel>, &data);
+  threader->SingleMethodExecute();
+
+  if(data.errorCondition < 0)
   {
-    tDims[i] = size[i];
+    setErrorCondition(data.errorCondition);
+    notifyErrorMessage(getHumanLabel(), data.errorMessage, getErrorCondition());
   }
+}
 
-  QVector<size_t> cDims(1, 1);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> void ITKImportImageStack::readImageOutputInformation(const QVector<size_t>& tDims, const QVector<size_t>& cDims, DataContainer::Pointer& container)
+{
   AttributeMatrix::Pointer cellAttrMat = container->createNonPrereqAttributeMatrix<AbstractFilter>(this, m_CellAttributeMatrixName, tDims, AttributeMatrix::Type::Cell);
   if(getErrorCondition() < 0)
   {
@@ -436,6 +688,10 @@ AbstractFilter::Pointer ITKImportImageStack::newFilterInstance(bool copyFilterPa
     SIMPL_COPY_INSTANCEVAR(InputFileListInfo)
     SIMPL_COPY_INSTANCEVAR(ImageStack)
     SIMPL_COPY_INSTANCEVAR(ImageDataArrayName)
+    SIMPL_COPY_INSTANCEVAR(NumberOfThreads)
+    SIMPL_COPY_INSTANCEVAR(RegionStart)
+    SIMPL_COPY_INSTANCEVAR(RegionSize)
+    SIMPL_COPY_INSTANCEVAR(Stride)
   }
   return filter;
 }
@@ -36,17 +36,21 @@
 #ifndef _ITKImportImageStack_H_
 #define _ITKImportImageStack_H_
 
+#include <QtCore/QCache>
 #include <QtCore/QFile>
+#include <QtCore/QMutex>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkReadRegion.h"
 
-#include <itkImageSeriesReader.h>
+#include <itkImageIOBase.h>
 
 /**
  * @brief The ITKImportImageStack class. See [Filter documentation](@ref itkimportimagestack) for details.
@@ -85,6 +89,18 @@ public:
   SIMPL_FILTER_PARAMETER(QString, ImageDataArrayName)
   Q_PROPERTY(QString ImageDataArrayName READ getImageDataArrayName WRITE setImageDataArrayName)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfThreads)
+  Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, RegionStart)
+  Q_PROPERTY(IntVec3_t RegionStart READ getRegionStart WRITE setRegionStart)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, RegionSize)
+  Q_PROPERTY(IntVec3_t RegionSize READ getRegionSize WRITE setRegionSize)
+
+  SIMPL_FILTER_PARAMETER(IntVec3_t, Stride)
+  Q_PROPERTY(IntVec3_t Stride READ getStride WRITE setStride)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -191,18 +207,52 @@ private:
    */
   QVector<QString> getFileList();
 
+  /**
+   * @brief The SliceInformation struct holds what preflight needs from the header of the first slice.
+   * Multi-component pixels (RGB, RGBA, vectors) are imported as 'numberOfComponents' interleaved
+   * values of the component type, so they do not need their own template instantiations.
+   */
+  struct SliceInformation
+  {
+    itk::ImageIOBase::IOComponentType componentType;
+    unsigned int numberOfDimensions;
+    unsigned int numberOfComponents;
+    size_t sliceDims[2];
+  };
+
+  /**
+   * @brief Slice information of the stacks previously preflighted, keyed by a hash of the file
+   * list and of the modification times of the files. Shared by all the instances of the filter.
+   */
+  static QMutex s_SliceInformationMutex;
+  static QCache<QByteArray, SliceInformation> s_SliceInformationCache;
+
+  bool findSliceInformation(const QByteArray& key, SliceInformation& information);
+  void insertSliceInformation(const QByteArray& key, const SliceInformation& information);
+
   /**
    * @brief readImage does the work of reading in the image. If \c dataCheck
-   * is true, only the image information is read -- pixel buffer information
-   * is not read.
+   * is true, only the header of the first slice is read and the size of the
+   * volume is inferred from the number of files. The other slices are checked
+   * when they are read.
    */
   void readImage(const QVector<QString>& fileList, bool dataCheck);
-  template <typename TPixel> void readImageWithPixelType(const QVector<QString>& fileList, bool dataCheck);
+  template <typename TPixel>
+  void readImageWithPixelType(const QVector<QString>& fileList, const SliceInformation& information, const ITKDream3DHelper::ReadRegion& region, bool dataCheck);
 
   /**
-  * @brief Reads image size, spacing and origin, and updates container information accordingly.
+  * @brief Creates the cell attribute matrix and the image data array.
   */
-  template <typename TPixel> void readImageOutputInformation(typename itk::ImageSeriesReader<itk::Dream3DImage<TPixel, 3>>::Pointer& reader, DataContainer::Pointer& container);
+  template <typename TPixel> void readImageOutputInformation(const QVector<size_t>& tDims, const QVector<size_t>& cDims, DataContainer::Pointer& container);
+
+  /**
+   * @brief Decodes the slices of the stack concurrently, each one directly at its z-offset in the
+   * image data array when its pixel type is the one of the array. Each thread decodes one slice at
+   * a time, which bounds the number of slices in flight. 'fileList' only holds the slices of the
+   * region, whose X and Y extent is requested from the ImageIO of each slice.
+   */
+  template <typename TPixel>
+  void readImageSlices(const QVector<QString>& fileList, const SliceInformation& information, const ITKDream3DHelper::ReadRegion& region, DataContainer::Pointer& container);
 
   DEFINE_DATAARRAY_VARIABLE(uint8_t, ImageData)
 
@@ -52,6 +52,7 @@ void ITKIntensityWindowingImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKIntensityWindowingImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKIntensityWindowingImage::readFilterParameters(AbstractFilterParametersRe
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setWindowMinimum(reader->readValue("WindowMinimum", getWindowMinimum()));
   setWindowMaximum(reader->readValue("WindowMaximum", getWindowMaximum()));
   setOutputMinimum(reader->readValue("OutputMinimum", getOutputMinimum()));
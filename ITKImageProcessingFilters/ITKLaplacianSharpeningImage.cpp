@@ -46,6 +46,7 @@ void ITKLaplacianSharpeningImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKLaplacianSharpeningImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -67,6 +68,7 @@ void ITKLaplacianSharpeningImage::readFilterParameters(AbstractFilterParametersR
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setUseImageSpacing(reader->readValue("UseImageSpacing", getUseImageSpacing()));
 
   reader->closeFilterGroup();
@@ -151,3 +153,12 @@ const QString ITKLaplacianSharpeningImage::getSubGroupName() const
 {
   return "ITK Edge";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKLaplacianSharpeningImage::isStreamable() const
+{
+  // The intensity statistics are computed on the whole image
+  return false;
+}
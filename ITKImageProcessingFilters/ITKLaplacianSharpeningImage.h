@@ -92,6 +92,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKLaplacianSharpeningImage(const ITKLaplacianSharpeningImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKLaplacianSharpeningImage&);              // Operator '=' Not Implemented
@@ -105,6 +105,11 @@ protected:
 
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> typename std::enable_if<!std::is_scalar<InputPixelType>::value>::type convertDataContainerType();
 
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKMaskImage(const ITKMaskImage&);   // Copy Constructor Not Implemented
   void operator=(const ITKMaskImage&) = delete; // Operator '=' Not Implemented
@@ -50,6 +50,7 @@ void ITKMinMaxCurvatureFlowImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKMinMaxCurvatureFlowImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -71,6 +72,7 @@ void ITKMinMaxCurvatureFlowImage::readFilterParameters(AbstractFilterParametersR
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
   setStencilRadius(reader->readValue("StencilRadius", getStencilRadius()));
@@ -161,3 +163,20 @@ const QString ITKMinMaxCurvatureFlowImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMinMaxCurvatureFlowImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKMinMaxCurvatureFlowImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
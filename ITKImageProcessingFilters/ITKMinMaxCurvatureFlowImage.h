@@ -99,6 +99,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief getInternalBufferFactor Reimplemented from @see ITKImageBase class
+   */
+  virtual double getInternalBufferFactor() const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKMinMaxCurvatureFlowImage(const ITKMinMaxCurvatureFlowImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKMinMaxCurvatureFlowImage&);              // Operator '=' Not Implemented
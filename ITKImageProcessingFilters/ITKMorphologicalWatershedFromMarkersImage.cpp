@@ -47,6 +47,7 @@ void ITKMorphologicalWatershedFromMarkersImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKMorphologicalWatershedFromMarkersImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -70,6 +71,7 @@ void ITKMorphologicalWatershedFromMarkersImage::readFilterParameters(AbstractFil
   setSelectedCellArrayPath(reader->readDataArrayPath("MarkerCellArrayPath", getMarkerCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setMarkWatershedLine(reader->readValue("MarkWatershedLine", getMarkWatershedLine()));
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
 
@@ -235,3 +237,29 @@ const QString ITKMorphologicalWatershedFromMarkersImage::getSubGroupName() const
 {
   return "ITK Segmentation";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMorphologicalWatershedFromMarkersImage::getInternalBufferFactor() const
+{
+  return 2.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKMorphologicalWatershedFromMarkersImage::isStreamable() const
+{
+  // The flooding is propagated across the whole image
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKMorphologicalWatershedFromMarkersImage::canProcessSlicesIndependently() const
+{
+  // The second input image is not split into slices
+  return false;
+}
@@ -107,6 +107,21 @@ protected:
   */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void convertDataContainerType();
 
+  /**
+   * @brief getInternalBufferFactor Reimplemented from @see ITKImageBase class
+   */
+  virtual double getInternalBufferFactor() const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKMorphologicalWatershedFromMarkersImage(const ITKMorphologicalWatershedFromMarkersImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKMorphologicalWatershedFromMarkersImage&);                            // Operator '=' Not Implemented
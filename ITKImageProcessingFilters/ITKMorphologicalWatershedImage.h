@@ -99,6 +99,21 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief getInternalBufferFactor Reimplemented from @see ITKImageBase class
+   */
+  virtual double getInternalBufferFactor() const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKMorphologicalWatershedImage(const ITKMorphologicalWatershedImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKMorphologicalWatershedImage&);                 // Operator '=' Not Implemented
@@ -69,6 +69,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKMultiScaleHessianBasedObjectnessImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -90,6 +91,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::readFilterParameters(AbstractFilt
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setObjectDimension(reader->readValue("ObjectDimension", getObjectDimension()));
   setAlpha(reader->readValue("Alpha", getAlpha()));
   setBeta(reader->readValue("Beta", getBeta()));
@@ -201,3 +203,20 @@ const QString ITKMultiScaleHessianBasedObjectnessImage::getSubGroupName() const
 {
   return "ITK Edge";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMultiScaleHessianBasedObjectnessImage::getInternalBufferFactor() const
+{
+  return 8.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKMultiScaleHessianBasedObjectnessImage::isStreamable() const
+{
+  // Recursive Gaussian filters run along whole image lines in every direction
+  return false;
+}
@@ -88,6 +88,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKNormalizeImage(const ITKNormalizeImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKNormalizeImage&);    // Operator '=' Not Implemented
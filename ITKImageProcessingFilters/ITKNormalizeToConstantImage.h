@@ -92,6 +92,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKNormalizeToConstantImage(const ITKNormalizeToConstantImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKNormalizeToConstantImage&);              // Operator '=' Not Implemented
@@ -52,6 +52,7 @@ void ITKOtsuMultipleThresholdsImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKOtsuMultipleThresholdsImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKOtsuMultipleThresholdsImage::readFilterParameters(AbstractFilterParamete
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setNumberOfThresholds(reader->readValue("NumberOfThresholds", getNumberOfThresholds()));
   setLabelOffset(reader->readValue("LabelOffset", getLabelOffset()));
   setNumberOfHistogramBins(reader->readValue("NumberOfHistogramBins", getNumberOfHistogramBins()));
@@ -166,3 +168,12 @@ const QString ITKOtsuMultipleThresholdsImage::getSubGroupName() const
 {
   return "ITK Thresholding";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKOtsuMultipleThresholdsImage::isStreamable() const
+{
+  // The intensity statistics are computed on the whole image
+  return false;
+}
@@ -103,6 +103,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKOtsuMultipleThresholdsImage(const ITKOtsuMultipleThresholdsImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKOtsuMultipleThresholdsImage&);                 // Operator '=' Not Implemented
@@ -86,6 +86,7 @@ void ITKPatchBasedDenoisingImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKPatchBasedDenoisingImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -107,6 +108,7 @@ void ITKPatchBasedDenoisingImage::readFilterParameters(AbstractFilterParametersR
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setKernelBandwidthSigma(reader->readValue("KernelBandwidthSigma", getKernelBandwidthSigma()));
   setPatchRadius(reader->readValue("PatchRadius", getPatchRadius()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
@@ -236,3 +238,20 @@ const QString ITKPatchBasedDenoisingImage::getSubGroupName() const
 {
   return "ITK Denoising";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPatchBasedDenoisingImage::getInternalBufferFactor() const
+{
+  return 4.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKPatchBasedDenoisingImage::isStreamable() const
+{
+  // Each iteration needs the result of the previous one on the whole image
+  return false;
+}
@@ -0,0 +1,196 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKPixelExpressionImage.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/Dream3DTemplateAliasMacro.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkDream3DImage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkPixelExpressionImageFilter.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPixelExpressionImage::ITKPixelExpressionImage()
+: ITKImageBase()
+, m_Expression("x")
+, m_OutputType(0)
+{
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPixelExpressionImage::~ITKPixelExpressionImage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPixelExpressionImage::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+
+  parameters.push_back(SIMPL_NEW_STRING_FP("Expression", Expression, FilterParameter::Parameter, ITKPixelExpressionImage));
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Output Type");
+    parameter->setPropertyName("OutputType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKPixelExpressionImage, this, OutputType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKPixelExpressionImage, this, OutputType));
+
+    // The choices after the first one follow the order of itk::ImageIOBase::IOComponentType
+    QVector<QString> choices;
+    choices.push_back("same as input");
+    choices.push_back("unsigned char");
+    choices.push_back("char");
+    choices.push_back("unsigned short");
+    choices.push_back("short");
+    choices.push_back("unsigned int");
+    choices.push_back("int");
+    choices.push_back("unsigned long");
+    choices.push_back("long");
+    choices.push_back("float");
+    choices.push_back("double");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  QStringList linkedProps;
+  linkedProps << "NewCellArrayName";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKPixelExpressionImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to filter", SelectedCellArrayPath, FilterParameter::RequiredArray, ITKPixelExpressionImage, req));
+  }
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::CreatedArray, ITKPixelExpressionImage));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPixelExpressionImage::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
+  setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
+  setExpression(reader->readString("Expression", getExpression()));
+  setOutputType(reader->readValue("OutputType", getOutputType()));
+
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKPixelExpressionImage::dataCheck()
+{
+  // Check consistency of parameters
+  setErrorCondition(0);
+  setWarningCondition(0);
+  std::string errorMessage;
+  if(!m_CompiledExpression.Compile(getExpression().toStdString(), errorMessage))
+  {
+    setErrorCondition(-20);
+    notifyErrorMessage(getHumanLabel(), QString("Invalid expression: %1").arg(QString::fromStdString(errorMessage)), getErrorCondition());
+    return;
+  }
+  ITKImageBase::dataCheck<InputPixelType, OutputPixelType, Dimension>();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPixelExpressionImage::dataCheckInternal()
+{
+  if(m_OutputType == 0)
+  {
+    Dream3DArraySwitchMacro(this->dataCheck, getSelectedCellArrayPath(), -4);
+    return;
+  }
+  Dream3DArraySwitchOutputComponentMacro(this->dataCheck, m_OutputType - 1, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKPixelExpressionImage::filter()
+{
+  typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
+  typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+  // define filter
+  typedef itk::PixelExpressionImageFilter<InputImageType, OutputImageType> FilterType;
+  typename FilterType::Pointer filter = FilterType::New();
+  // The expression was compiled by dataCheck(), which execute() always runs first.
+  filter->SetExpression(m_CompiledExpression);
+  this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPixelExpressionImage::filterInternal()
+{
+  if(m_OutputType == 0)
+  {
+    Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
+    return;
+  }
+  Dream3DArraySwitchOutputComponentMacro(this->filter, m_OutputType - 1, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ITKPixelExpressionImage::newFilterInstance(bool copyFilterParameters) const
+{
+  ITKPixelExpressionImage::Pointer filter = ITKPixelExpressionImage::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKPixelExpressionImage::getHumanLabel() const
+{
+  return "ITK::Pixel Expression Image Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid ITKPixelExpressionImage::getUuid()
+{
+  return QUuid("{3c2293fc-faed-4d42-936c-c5d1a58bc5d2}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKPixelExpressionImage::getSubGroupName() const
+{
+  return "ITK IntensityTransformation";
+}
@@ -0,0 +1,106 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#ifndef _ITKPixelExpressionImage_h_
+#define _ITKPixelExpressionImage_h_
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+#include "ITKImageBase.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkPixelExpression.h"
+
+/**
+ * @brief The ITKPixelExpressionImage class. See [Filter documentation](@ref ITKPixelExpressionImage) for details.
+ */
+class ITKPixelExpressionImage : public ITKImageBase
+{
+  Q_OBJECT
+
+public:
+  SIMPL_SHARED_POINTERS(ITKPixelExpressionImage)
+  SIMPL_STATIC_NEW_MACRO(ITKPixelExpressionImage)
+   SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ITKPixelExpressionImage, AbstractFilter)
+
+  virtual ~ITKPixelExpressionImage();
+
+  SIMPL_FILTER_PARAMETER(QString, Expression)
+  Q_PROPERTY(QString Expression READ getExpression WRITE setExpression)
+
+  SIMPL_FILTER_PARAMETER(int, OutputType)
+  Q_PROPERTY(int OutputType READ getOutputType WRITE setOutputType)
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  virtual const QString getHumanLabel() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  virtual const QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  virtual const QUuid getUuid() override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  virtual void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  virtual void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+protected:
+  ITKPixelExpressionImage();
+
+  /**
+   * @brief dataCheckInternal overloads dataCheckInternal in ITKImageBase and calls templated dataCheck
+   */
+  void virtual dataCheckInternal() override;
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void dataCheck();
+
+  /**
+  * @brief filterInternal overloads filterInternal in ITKImageBase and calls templated filter
+  */
+  void virtual filterInternal() override;
+
+  /**
+  * @brief Applies the filter
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
+
+private:
+  ITKPixelExpressionImage(const ITKPixelExpressionImage&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ITKPixelExpressionImage&);                  // Operator '=' Not Implemented
+
+  // Expression compiled by dataCheck()
+  itk::PixelExpression m_CompiledExpression;
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif /* _ITKPixelExpressionImage_H_ */
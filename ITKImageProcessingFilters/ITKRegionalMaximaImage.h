@@ -102,6 +102,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKRegionalMaximaImage(const ITKRegionalMaximaImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKRegionalMaximaImage&);         // Operator '=' Not Implemented
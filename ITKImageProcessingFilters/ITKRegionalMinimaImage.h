@@ -102,6 +102,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKRegionalMinimaImage(const ITKRegionalMinimaImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKRegionalMinimaImage&);         // Operator '=' Not Implemented
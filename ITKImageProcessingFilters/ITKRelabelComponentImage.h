@@ -92,6 +92,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKRelabelComponentImage(const ITKRelabelComponentImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKRelabelComponentImage&);           // Operator '=' Not Implemented
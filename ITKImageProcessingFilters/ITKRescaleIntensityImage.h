@@ -103,6 +103,11 @@ protected:
   */
   template <typename OutputPixelType> void CheckEntryBounds(double value, QString name);
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKRescaleIntensityImage(const ITKRescaleIntensityImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKRescaleIntensityImage&);           // Operator '=' Not Implemented
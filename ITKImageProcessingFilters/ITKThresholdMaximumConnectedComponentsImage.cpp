@@ -52,6 +52,7 @@ void ITKThresholdMaximumConnectedComponentsImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKThresholdMaximumConnectedComponentsImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +74,7 @@ void ITKThresholdMaximumConnectedComponentsImage::readFilterParameters(AbstractF
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setMinimumObjectSizeInPixels(reader->readValue("MinimumObjectSizeInPixels", getMinimumObjectSizeInPixels()));
   setUpperBoundary(reader->readValue("UpperBoundary", getUpperBoundary()));
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
@@ -166,3 +168,21 @@ const QString ITKThresholdMaximumConnectedComponentsImage::getSubGroupName() con
 {
   return "ITK Thresholding";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKThresholdMaximumConnectedComponentsImage::isStreamable() const
+{
+  // Labels are assigned over the whole image
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKThresholdMaximumConnectedComponentsImage::canProcessSlicesIndependently() const
+{
+  // The threshold is chosen from the objects of the whole image
+  return false;
+}
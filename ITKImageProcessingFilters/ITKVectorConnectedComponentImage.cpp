@@ -61,6 +61,7 @@ void ITKVectorConnectedComponentImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKVectorConnectedComponentImage, linkedProps));
+  setupExecutionFilterParameters(parameters);
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -82,6 +83,7 @@ void ITKVectorConnectedComponentImage::readFilterParameters(AbstractFilterParame
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   setDistanceThreshold(reader->readValue("DistanceThreshold", getDistanceThreshold()));
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
 
@@ -172,3 +174,21 @@ const QString ITKVectorConnectedComponentImage::getSubGroupName() const
 {
   return "ITK Segmentation";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKVectorConnectedComponentImage::isStreamable() const
+{
+  // Labels are assigned over the whole image
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKVectorConnectedComponentImage::canProcessSlicesIndependently() const
+{
+  // Components crossing slices would get a different label in each slice, and the labels of the slices would collide
+  return false;
+}
@@ -96,6 +96,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
+  /**
+   * @brief canProcessSlicesIndependently Reimplemented from @see ITKImageBase class
+   */
+  virtual bool canProcessSlicesIndependently() const override;
+
 private:
   ITKVectorConnectedComponentImage(const ITKVectorConnectedComponentImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKVectorConnectedComponentImage&);                   // Operator '=' Not Implemented
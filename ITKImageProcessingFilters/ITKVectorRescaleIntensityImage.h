@@ -100,6 +100,11 @@ protected:
   */
   template <typename OutputPixelType> void CheckEntryBounds(double value, QString name);
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  virtual bool isStreamable() const override;
+
 private:
   ITKVectorRescaleIntensityImage(const ITKVectorRescaleIntensityImage&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKVectorRescaleIntensityImage&);                 // Operator '=' Not Implemented
@@ -0,0 +1,714 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+#include "itkChunkedVolumeImageIO.h"
+
+#include "itkByteSwapper.h"
+#include "itkMultiThreader.h"
+#include "itk_zlib.h"
+#include <itksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace itk
+{
+namespace
+{
+const char* const ChunkedVolumeMagic = "ChunkedVolume 1";
+const char* const ChunkedVolumeHeaderEnd = "HeaderEnd";
+const char* const ChunkedVolumeExtension = ".cvol";
+
+/**
+ * @brief The Box struct is a box of pixels of the image, padded to 3 dimensions.
+ */
+struct Box
+{
+  SizeValueType start[3];
+  SizeValueType size[3];
+
+  SizeValueType GetNumberOfPixels() const
+  {
+    return size[0] * size[1] * size[2];
+  }
+};
+
+/**
+ * @brief The BlockLayout struct describes how an image is cut in cubic blocks.
+ */
+struct BlockLayout
+{
+  SizeValueType imageSize[3];
+  SizeValueType blockSize;
+  SizeValueType blockCount[3];
+
+  BlockLayout(const ImageIOBase* io, SizeValueType edge)
+  : blockSize(edge)
+  {
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      imageSize[i] = (i < io->GetNumberOfDimensions() ? io->GetDimensions(i) : 1);
+      blockCount[i] = (imageSize[i] + blockSize - 1) / blockSize;
+    }
+  }
+
+  SizeValueType GetNumberOfBlocks() const
+  {
+    return blockCount[0] * blockCount[1] * blockCount[2];
+  }
+
+  /**
+   * @brief GetBlockBox Returns the pixels of the block 'block', clipped to the image.
+   */
+  Box GetBlockBox(SizeValueType block) const
+  {
+    const SizeValueType blockIndex[3] = {block % blockCount[0], (block / blockCount[0]) % blockCount[1], block / (blockCount[0] * blockCount[1])};
+    Box box;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      box.start[i] = blockIndex[i] * blockSize;
+      box.size[i] = std::min(blockSize, imageSize[i] - box.start[i]);
+    }
+    return box;
+  }
+};
+
+/**
+ * @brief CopyBox Copies the pixels of the intersection of the boxes 'sourceBox' and
+ * 'destinationBox' from 'source', the pixels of 'sourceBox', to 'destination', the pixels of
+ * 'destinationBox'.
+ */
+void CopyBox(const char* source, const Box& sourceBox, char* destination, const Box& destinationBox, SizeValueType pixelSize)
+{
+  SizeValueType begin[3];
+  SizeValueType end[3];
+  for(unsigned int i = 0; i < 3; i++)
+  {
+    begin[i] = std::max(sourceBox.start[i], destinationBox.start[i]);
+    end[i] = std::min(sourceBox.start[i] + sourceBox.size[i], destinationBox.start[i] + destinationBox.size[i]);
+    if(begin[i] >= end[i])
+    {
+      return;
+    }
+  }
+  const SizeValueType rowSize = (end[0] - begin[0]) * pixelSize;
+  for(SizeValueType z = begin[2]; z < end[2]; z++)
+  {
+    for(SizeValueType y = begin[1]; y < end[1]; y++)
+    {
+      const SizeValueType sourceOffset = (((z - sourceBox.start[2]) * sourceBox.size[1] + (y - sourceBox.start[1])) * sourceBox.size[0] + (begin[0] - sourceBox.start[0])) * pixelSize;
+      const SizeValueType destinationOffset =
+          (((z - destinationBox.start[2]) * destinationBox.size[1] + (y - destinationBox.start[1])) * destinationBox.size[0] + (begin[0] - destinationBox.start[0])) * pixelSize;
+      std::memcpy(destination + destinationOffset, source + sourceOffset, rowSize);
+    }
+  }
+}
+
+/**
+ * @brief SwapLittleEndian Converts 'numberOfValues' values of 'valueSize' bytes between little
+ * endian and the byte order of the system.
+ */
+void SwapLittleEndian(char* data, SizeValueType numberOfValues, SizeValueType valueSize)
+{
+  if(!ByteSwapper<int>::SystemIsBigEndian() || valueSize == 1)
+  {
+    return;
+  }
+  for(SizeValueType i = 0; i < numberOfValues; i++)
+  {
+    std::reverse(data + i * valueSize, data + (i + 1) * valueSize);
+  }
+}
+
+void WriteUInt64(std::ostream& stream, uint64_t value)
+{
+  char bytes[8];
+  for(unsigned int i = 0; i < 8; i++)
+  {
+    bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+  stream.write(bytes, 8);
+}
+
+uint64_t ReadUInt64(const char* bytes)
+{
+  uint64_t value = 0;
+  for(unsigned int i = 0; i < 8; i++)
+  {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+  }
+  return value;
+}
+
+template <typename T> std::vector<T> ReadValues(std::istringstream& stream)
+{
+  std::vector<T> values;
+  T value;
+  while(stream >> value)
+  {
+    values.push_back(value);
+  }
+  return values;
+}
+
+/**
+ * @brief The BlockJobs struct is shared by the threads that decode or encode the blocks.
+ * Blocks are handed out one at a time through 'next'.
+ */
+struct BlockJobs
+{
+  const BlockLayout* layout;
+  SizeValueType pixelSize;
+  SizeValueType componentSize;
+  bool compressed;
+  std::vector<SizeValueType> blocks;
+  std::atomic<size_t> next;
+  std::atomic<bool> failed;
+  std::mutex errorMutex;
+  std::string error;
+
+  // Decoding
+  std::string fileName;
+  const std::vector<uint64_t>* offsets;
+  const std::vector<uint64_t>* sizes;
+  char* region;
+  Box regionBox;
+
+  // Encoding
+  const char* image;
+  Box imageBox;
+  int compressionLevel;
+  std::vector<std::vector<char>> encoded;
+
+  void setError(const std::string& message)
+  {
+    std::lock_guard<std::mutex> lock(errorMutex);
+    if(error.empty())
+    {
+      error = message;
+    }
+    failed = true;
+  }
+};
+
+ITK_THREAD_RETURN_TYPE DecodeBlocksCallback(void* arg)
+{
+  MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*>(arg);
+  BlockJobs* jobs = static_cast<BlockJobs*>(info->UserData);
+  std::ifstream file(jobs->fileName.c_str(), std::ios::in | std::ios::binary);
+  if(!file)
+  {
+    jobs->setError("Could not open " + jobs->fileName);
+    return ITK_THREAD_RETURN_VALUE;
+  }
+  // An exception escaping a thread of the MultiThreader would terminate the application
+  try
+  {
+    std::vector<char> encoded;
+    std::vector<char> decoded;
+    for(size_t j = jobs->next++; j < jobs->blocks.size() && !jobs->failed; j = jobs->next++)
+    {
+      const SizeValueType block = jobs->blocks[j];
+      const Box box = jobs->layout->GetBlockBox(block);
+      const SizeValueType decodedSize = box.GetNumberOfPixels() * jobs->pixelSize;
+      const uint64_t encodedSize = (*jobs->sizes)[block];
+      decoded.resize(decodedSize);
+      std::vector<char>& buffer = (jobs->compressed ? encoded : decoded);
+      buffer.resize(encodedSize);
+      file.seekg(static_cast<std::streamoff>((*jobs->offsets)[block]));
+      file.read(buffer.data(), static_cast<std::streamsize>(encodedSize));
+      if(!file)
+      {
+        jobs->setError("Could not read a block of " + jobs->fileName);
+        break;
+      }
+      if(jobs->compressed)
+      {
+        uLongf length = static_cast<uLongf>(decodedSize);
+        if(uncompress(reinterpret_cast<Bytef*>(decoded.data()), &length, reinterpret_cast<const Bytef*>(encoded.data()), static_cast<uLong>(encodedSize)) != Z_OK || length != decodedSize)
+        {
+          jobs->setError("Could not decompress a block of " + jobs->fileName);
+          break;
+        }
+      }
+      SwapLittleEndian(decoded.data(), decodedSize / jobs->componentSize, jobs->componentSize);
+      CopyBox(decoded.data(), box, jobs->region, jobs->regionBox, jobs->pixelSize);
+    }
+  } catch(const std::exception& e)
+  {
+    jobs->setError(std::string("Could not decode the blocks of ") + jobs->fileName + ": " + e.what());
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+ITK_THREAD_RETURN_TYPE EncodeBlocksCallback(void* arg)
+{
+  MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*>(arg);
+  BlockJobs* jobs = static_cast<BlockJobs*>(info->UserData);
+  // An exception escaping a thread of the MultiThreader would terminate the application
+  try
+  {
+    std::vector<char> raw;
+    for(size_t j = jobs->next++; j < jobs->blocks.size() && !jobs->failed; j = jobs->next++)
+    {
+      const Box box = jobs->layout->GetBlockBox(jobs->blocks[j]);
+      const SizeValueType rawSize = box.GetNumberOfPixels() * jobs->pixelSize;
+      raw.resize(rawSize);
+      CopyBox(jobs->image, jobs->imageBox, raw.data(), box, jobs->pixelSize);
+      SwapLittleEndian(raw.data(), rawSize / jobs->componentSize, jobs->componentSize);
+      std::vector<char>& encoded = jobs->encoded[j];
+      if(!jobs->compressed)
+      {
+        encoded.swap(raw);
+        continue;
+      }
+      uLongf length = compressBound(static_cast<uLong>(rawSize));
+      encoded.resize(length);
+      if(compress2(reinterpret_cast<Bytef*>(encoded.data()), &length, reinterpret_cast<const Bytef*>(raw.data()), static_cast<uLong>(rawSize), jobs->compressionLevel) != Z_OK)
+      {
+        jobs->setError("Could not compress a block");
+        break;
+      }
+      encoded.resize(length);
+    }
+  } catch(const std::exception& e)
+  {
+    // Write() reports it after the threads are joined
+    jobs->setError(std::string("Could not encode a block (") + e.what() + ")");
+  }
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+void RunJobs(ThreadFunctionType callback, BlockJobs& jobs)
+{
+  jobs.next = 0;
+  jobs.failed = false;
+  MultiThreader::Pointer threader = MultiThreader::New();
+  const size_t numberOfThreads = std::min<size_t>(MultiThreader::GetGlobalDefaultNumberOfThreads(), jobs.blocks.size());
+  threader->SetNumberOfThreads(static_cast<ThreadIdType>(std::max<size_t>(1, numberOfThreads)));
+  threader->SetSingleMethod(callback, &jobs);
+  threader->SingleMethodExecute();
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ChunkedVolumeImageIO::ChunkedVolumeImageIO()
+: m_BlockSize(64)
+, m_CompressionLevel(6)
+, m_FileBlockSize(0)
+, m_FileCompressed(false)
+, m_IndexOffset(0)
+{
+  this->SetNumberOfDimensions(3);
+  this->AddSupportedReadExtension(ChunkedVolumeExtension);
+  this->AddSupportedWriteExtension(ChunkedVolumeExtension);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ChunkedVolumeImageIO::~ChunkedVolumeImageIO()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ChunkedVolumeImageIO::CanReadFile(const char* fileName)
+{
+  const std::string extension = itksys::SystemTools::LowerCase(itksys::SystemTools::GetFilenameLastExtension(fileName));
+  if(extension != ChunkedVolumeExtension)
+  {
+    return false;
+  }
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  std::string line;
+  return file && std::getline(file, line) && line == ChunkedVolumeMagic;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ChunkedVolumeImageIO::ReadImageInformation()
+{
+  std::ifstream file(m_FileName.c_str(), std::ios::in | std::ios::binary);
+  if(!file)
+  {
+    itkExceptionMacro(<< "Could not open " << m_FileName);
+  }
+  std::string line;
+  if(!std::getline(file, line) || line != ChunkedVolumeMagic)
+  {
+    itkExceptionMacro(<< m_FileName << " is not a chunked volume file");
+  }
+  unsigned int dimension = 0;
+  std::vector<SizeValueType> dimensions;
+  std::vector<double> spacing;
+  std::vector<double> origin;
+  std::vector<double> direction;
+  std::string componentType;
+  std::string pixelType;
+  unsigned int numberOfComponents = 1;
+  unsigned int blockSize = 0;
+  std::string compression;
+  while(std::getline(file, line) && line != ChunkedVolumeHeaderEnd)
+  {
+    std::istringstream stream(line);
+    std::string key;
+    stream >> key;
+    if(key == "NDims")
+    {
+      stream >> dimension;
+    }
+    else if(key == "DimSize")
+    {
+      dimensions = ReadValues<SizeValueType>(stream);
+    }
+    else if(key == "ElementSpacing")
+    {
+      spacing = ReadValues<double>(stream);
+    }
+    else if(key == "Offset")
+    {
+      origin = ReadValues<double>(stream);
+    }
+    else if(key == "TransformMatrix")
+    {
+      direction = ReadValues<double>(stream);
+    }
+    else if(key == "ComponentType")
+    {
+      stream >> componentType;
+    }
+    else if(key == "PixelType")
+    {
+      stream >> pixelType;
+    }
+    else if(key == "NumberOfComponents")
+    {
+      stream >> numberOfComponents;
+    }
+    else if(key == "BlockSize")
+    {
+      stream >> blockSize;
+    }
+    else if(key == "Compression")
+    {
+      stream >> compression;
+    }
+  }
+  if(line != ChunkedVolumeHeaderEnd)
+  {
+    itkExceptionMacro(<< "The header of " << m_FileName << " is truncated");
+  }
+  if(!this->SupportsDimension(dimension) || dimensions.size() != dimension || blockSize == 0 || numberOfComponents == 0)
+  {
+    itkExceptionMacro(<< "The header of " << m_FileName << " is invalid");
+  }
+
+  IOComponentType fileComponentType = UNKNOWNCOMPONENTTYPE;
+  for(int type = UCHAR; type <= DOUBLE; type++)
+  {
+    if(GetComponentTypeAsString(static_cast<IOComponentType>(type)) == componentType)
+    {
+      fileComponentType = static_cast<IOComponentType>(type);
+    }
+  }
+  IOPixelType filePixelType = UNKNOWNPIXELTYPE;
+  for(int type = SCALAR; type <= MATRIX; type++)
+  {
+    if(GetPixelTypeAsString(static_cast<IOPixelType>(type)) == pixelType)
+    {
+      filePixelType = static_cast<IOPixelType>(type);
+    }
+  }
+  if(fileComponentType == UNKNOWNCOMPONENTTYPE || filePixelType == UNKNOWNPIXELTYPE)
+  {
+    itkExceptionMacro(<< "Unknown pixel type in " << m_FileName);
+  }
+  if(compression != "zlib" && compression != "none")
+  {
+    itkExceptionMacro(<< "Unknown compression '" << compression << "' in " << m_FileName);
+  }
+
+  this->SetNumberOfDimensions(dimension);
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    this->SetDimensions(i, dimensions[i]);
+    this->SetSpacing(i, (i < spacing.size() ? spacing[i] : 1.0));
+    this->SetOrigin(i, (i < origin.size() ? origin[i] : 0.0));
+    if(direction.size() == dimension * dimension)
+    {
+      std::vector<double> axis(direction.begin() + i * dimension, direction.begin() + (i + 1) * dimension);
+      this->SetDirection(i, axis);
+    }
+  }
+  this->SetComponentType(fileComponentType);
+  this->SetPixelType(filePixelType);
+  this->SetNumberOfComponents(numberOfComponents);
+  m_FileBlockSize = blockSize;
+  m_FileCompressed = (compression == "zlib");
+  m_IndexOffset = file.tellg();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageIORegion ChunkedVolumeImageIO::GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion& requested) const
+{
+  ImageIORegion streamableRegion(this->GetNumberOfDimensions());
+  for(unsigned int i = 0; i < this->GetNumberOfDimensions(); i++)
+  {
+    if(i < requested.GetImageDimension())
+    {
+      streamableRegion.SetIndex(i, requested.GetIndex(i));
+      streamableRegion.SetSize(i, requested.GetSize(i));
+    }
+    else
+    {
+      streamableRegion.SetIndex(i, 0);
+      streamableRegion.SetSize(i, this->GetDimensions(i));
+    }
+  }
+  return streamableRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ChunkedVolumeImageIO::Read(void* buffer)
+{
+  const BlockLayout layout(this, m_FileBlockSize);
+  BlockJobs jobs;
+  jobs.layout = &layout;
+  jobs.componentSize = this->GetComponentSize();
+  jobs.pixelSize = jobs.componentSize * this->GetNumberOfComponents();
+  jobs.compressed = m_FileCompressed;
+  jobs.fileName = m_FileName;
+  jobs.region = static_cast<char*>(buffer);
+  for(unsigned int i = 0; i < 3; i++)
+  {
+    const bool onAxis = (i < m_IORegion.GetImageDimension() && i < this->GetNumberOfDimensions());
+    jobs.regionBox.start[i] = (onAxis ? static_cast<SizeValueType>(m_IORegion.GetIndex(i)) : 0);
+    jobs.regionBox.size[i] = (onAxis ? m_IORegion.GetSize(i) : 1);
+    if(jobs.regionBox.size[i] == 0 || jobs.regionBox.start[i] + jobs.regionBox.size[i] > layout.imageSize[i])
+    {
+      itkExceptionMacro(<< "The region to read is outside of " << m_FileName);
+    }
+  }
+
+  // Index of the blocks
+  const SizeValueType numberOfBlocks = layout.GetNumberOfBlocks();
+  std::ifstream file(m_FileName.c_str(), std::ios::in | std::ios::binary);
+  file.seekg(0, std::ios::end);
+  const std::streamoff end = file.tellg();
+  const uint64_t fileSize = static_cast<uint64_t>(std::max<std::streamoff>(end, 0));
+  if(!file || end < 0 || m_IndexOffset < 0 || static_cast<uint64_t>(m_IndexOffset) > fileSize || numberOfBlocks > (fileSize - static_cast<uint64_t>(m_IndexOffset)) / 16)
+  {
+    itkExceptionMacro(<< "Could not read the block index of " << m_FileName);
+  }
+  std::vector<char> index(numberOfBlocks * 16);
+  file.seekg(m_IndexOffset);
+  file.read(index.data(), static_cast<std::streamsize>(index.size()));
+  if(!file)
+  {
+    itkExceptionMacro(<< "Could not read the block index of " << m_FileName);
+  }
+  std::vector<uint64_t> offsets(numberOfBlocks);
+  std::vector<uint64_t> sizes(numberOfBlocks);
+  for(SizeValueType block = 0; block < numberOfBlocks; block++)
+  {
+    offsets[block] = ReadUInt64(index.data() + 16 * block);
+    sizes[block] = ReadUInt64(index.data() + 16 * block + 8);
+  }
+  jobs.offsets = &offsets;
+  jobs.sizes = &sizes;
+
+  // Only the blocks that intersect the region are decoded
+  SizeValueType first[3];
+  SizeValueType last[3];
+  for(unsigned int i = 0; i < 3; i++)
+  {
+    first[i] = jobs.regionBox.start[i] / layout.blockSize;
+    last[i] = (jobs.regionBox.start[i] + jobs.regionBox.size[i] - 1) / layout.blockSize;
+  }
+  for(SizeValueType z = first[2]; z <= last[2]; z++)
+  {
+    for(SizeValueType y = first[1]; y <= last[1]; y++)
+    {
+      for(SizeValueType x = first[0]; x <= last[0]; x++)
+      {
+        jobs.blocks.push_back((z * layout.blockCount[1] + y) * layout.blockCount[0] + x);
+      }
+    }
+  }
+  // The index is checked before any block is read so that a corrupted file does not make the
+  // threads allocate or read past the end of the file
+  for(const SizeValueType block : jobs.blocks)
+  {
+    const uint64_t decodedSize = layout.GetBlockBox(block).GetNumberOfPixels() * jobs.pixelSize;
+    const uint64_t maximumSize = (m_FileCompressed ? compressBound(static_cast<uLong>(decodedSize)) : decodedSize);
+    if(offsets[block] > fileSize || sizes[block] > fileSize - offsets[block] || sizes[block] > maximumSize || (!m_FileCompressed && sizes[block] != decodedSize))
+    {
+      itkExceptionMacro(<< "Invalid block " << block << " in the block index of " << m_FileName);
+    }
+  }
+  RunJobs(DecodeBlocksCallback, jobs);
+  if(jobs.failed)
+  {
+    itkExceptionMacro(<< jobs.error);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ChunkedVolumeImageIO::CanWriteFile(const char* fileName)
+{
+  return itksys::SystemTools::LowerCase(itksys::SystemTools::GetFilenameLastExtension(fileName)) == ChunkedVolumeExtension;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ChunkedVolumeImageIO::WriteImageInformation()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ChunkedVolumeImageIO::Write(const void* buffer)
+{
+  const unsigned int dimension = this->GetNumberOfDimensions();
+  if(!this->SupportsDimension(dimension))
+  {
+    itkExceptionMacro(<< "Chunked volume files only support images of 1 to 3 dimensions");
+  }
+  const BlockLayout layout(this, m_BlockSize);
+  BlockJobs jobs;
+  jobs.layout = &layout;
+  jobs.componentSize = this->GetComponentSize();
+  jobs.pixelSize = jobs.componentSize * this->GetNumberOfComponents();
+  jobs.compressed = this->GetUseCompression();
+  jobs.compressionLevel = m_CompressionLevel;
+  jobs.image = static_cast<const char*>(buffer);
+  for(unsigned int i = 0; i < 3; i++)
+  {
+    jobs.imageBox.start[i] = 0;
+    jobs.imageBox.size[i] = layout.imageSize[i];
+  }
+
+  std::ofstream file(m_FileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!file)
+  {
+    itkExceptionMacro(<< "Could not open " << m_FileName << " for writing");
+  }
+  file.precision(17);
+  file << ChunkedVolumeMagic << "\n";
+  file << "NDims " << dimension << "\n";
+  file << "DimSize";
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    file << " " << this->GetDimensions(i);
+  }
+  file << "\nElementSpacing";
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    file << " " << this->GetSpacing(i);
+  }
+  file << "\nOffset";
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    file << " " << this->GetOrigin(i);
+  }
+  file << "\nTransformMatrix";
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    const std::vector<double> axis = this->GetDirection(i);
+    for(unsigned int j = 0; j < dimension; j++)
+    {
+      file << " " << axis[j];
+    }
+  }
+  file << "\nComponentType " << GetComponentTypeAsString(this->GetComponentType()) << "\n";
+  file << "PixelType " << GetPixelTypeAsString(this->GetPixelType()) << "\n";
+  file << "NumberOfComponents " << this->GetNumberOfComponents() << "\n";
+  file << "BlockSize " << m_BlockSize << "\n";
+  file << "Compression " << (jobs.compressed ? "zlib" : "none") << "\n";
+  file << ChunkedVolumeHeaderEnd << "\n";
+
+  // The index is written once the size of the blocks is known
+  const SizeValueType numberOfBlocks = layout.GetNumberOfBlocks();
+  const std::streamoff indexOffset = file.tellp();
+  std::vector<uint64_t> offsets(numberOfBlocks);
+  std::vector<uint64_t> sizes(numberOfBlocks);
+  const std::vector<char> emptyIndex(numberOfBlocks * 16, 0);
+  file.write(emptyIndex.data(), static_cast<std::streamsize>(emptyIndex.size()));
+
+  // Blocks are encoded in parallel by batches, so that only a few encoded blocks are kept in memory
+  const SizeValueType batchSize = 4 * MultiThreader::GetGlobalDefaultNumberOfThreads();
+  for(SizeValueType batchStart = 0; batchStart < numberOfBlocks; batchStart += batchSize)
+  {
+    const SizeValueType batchEnd = std::min(numberOfBlocks, batchStart + batchSize);
+    jobs.blocks.clear();
+    for(SizeValueType block = batchStart; block < batchEnd; block++)
+    {
+      jobs.blocks.push_back(block);
+    }
+    jobs.encoded.assign(jobs.blocks.size(), std::vector<char>());
+    RunJobs(EncodeBlocksCallback, jobs);
+    if(jobs.failed)
+    {
+      itkExceptionMacro(<< jobs.error << " of " << m_FileName);
+    }
+    for(size_t j = 0; j < jobs.blocks.size(); j++)
+    {
+      offsets[jobs.blocks[j]] = static_cast<uint64_t>(file.tellp());
+      sizes[jobs.blocks[j]] = jobs.encoded[j].size();
+      file.write(jobs.encoded[j].data(), static_cast<std::streamsize>(jobs.encoded[j].size()));
+    }
+  }
+  file.seekp(indexOffset);
+  for(SizeValueType block = 0; block < numberOfBlocks; block++)
+  {
+    WriteUInt64(file, offsets[block]);
+    WriteUInt64(file, sizes[block]);
+  }
+  if(!file)
+  {
+    itkExceptionMacro(<< "Could not write " << m_FileName);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ChunkedVolumeImageIO::PrintSelf(std::ostream& os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "BlockSize: " << m_BlockSize << std::endl;
+  os << indent << "CompressionLevel: " << m_CompressionLevel << std::endl;
+}
+} // end namespace itk
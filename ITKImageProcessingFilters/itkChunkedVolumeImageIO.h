@@ -0,0 +1,115 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+#ifndef itkChunkedVolumeImageIO_h
+#define itkChunkedVolumeImageIO_h
+
+#include "itkImageIOBase.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class ChunkedVolumeImageIO
+ * \brief ImageIO for the chunked volume files (.cvol) of the ITKImageProcessing plugin.
+ *
+ * The image is cut in cubic blocks of BlockSize pixels along each axis. Each block is compressed
+ * on its own with zlib and an index gives the position of every block in the file, so that a
+ * region of the image is read by decoding only the blocks it intersects. Blocks are compressed
+ * and decoded in parallel.
+ *
+ * The file starts with a text header in the style of MetaImage, ended by a "HeaderEnd" line. It
+ * is followed by the index, which holds the offset and the size in bytes of each block (as
+ * little endian 64-bit integers, blocks in x-fastest order), and by the blocks. The pixels of a
+ * block are stored x-fastest, with their components interleaved, in little endian.
+ *
+ * Images of 1 to 3 dimensions are supported.
+ *
+ * \ingroup IOFilters
+ */
+class ChunkedVolumeImageIO : public ImageIOBase
+{
+public:
+  typedef ChunkedVolumeImageIO Self;
+  typedef ImageIOBase Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ChunkedVolumeImageIO, ImageIOBase);
+
+  /** Edge length of the blocks written, in pixels. Default: 64. */
+  itkSetClampMacro(BlockSize, unsigned int, 1, 1024);
+  itkGetConstMacro(BlockSize, unsigned int);
+
+  /** zlib level of the blocks written, from 1 (fastest) to 9 (smallest). Default: 6.
+   * Blocks are only compressed if UseCompression is on. */
+  itkSetClampMacro(CompressionLevel, int, 1, 9);
+  itkGetConstMacro(CompressionLevel, int);
+
+  virtual bool SupportsDimension(unsigned long dimension) ITK_OVERRIDE
+  {
+    return dimension >= 1 && dimension <= 3;
+  }
+
+  virtual bool CanReadFile(const char* fileName) ITK_OVERRIDE;
+
+  virtual void ReadImageInformation() ITK_OVERRIDE;
+
+  /** Reads the IORegion: only the blocks that intersect it are decoded. */
+  virtual void Read(void* buffer) ITK_OVERRIDE;
+
+  virtual bool CanStreamRead() ITK_OVERRIDE
+  {
+    return true;
+  }
+
+  /** Any region can be read, the requested region is returned as is. */
+  virtual ImageIORegion GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion& requested) const ITK_OVERRIDE;
+
+  virtual bool CanWriteFile(const char* fileName) ITK_OVERRIDE;
+
+  /** The header is written with the pixels by Write(). */
+  virtual void WriteImageInformation() ITK_OVERRIDE;
+
+  /** Writes the whole image. */
+  virtual void Write(const void* buffer) ITK_OVERRIDE;
+
+protected:
+  ChunkedVolumeImageIO();
+  virtual ~ChunkedVolumeImageIO();
+
+  virtual void PrintSelf(std::ostream& os, Indent indent) const ITK_OVERRIDE;
+
+private:
+  ChunkedVolumeImageIO(const Self&) ITK_DELETE_FUNCTION;
+  void operator=(const Self&) ITK_DELETE_FUNCTION;
+
+  unsigned int m_BlockSize;
+  int m_CompressionLevel;
+
+  // Layout of the file read by ReadImageInformation()
+  unsigned int m_FileBlockSize;
+  bool m_FileCompressed;
+  std::streamoff m_IndexOffset;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,56 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+#include "itkChunkedVolumeImageIOFactory.h"
+
+#include "itkChunkedVolumeImageIO.h"
+#include "itkCreateObjectFunction.h"
+#include "itkVersion.h"
+
+namespace itk
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ChunkedVolumeImageIOFactory::ChunkedVolumeImageIOFactory()
+{
+  this->RegisterOverride("itkImageIOBase", "itkChunkedVolumeImageIO", "Chunked Volume Image IO", 1, CreateObjectFunction<ChunkedVolumeImageIO>::New());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ChunkedVolumeImageIOFactory::~ChunkedVolumeImageIOFactory()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* ChunkedVolumeImageIOFactory::GetITKSourceVersion() const
+{
+  return ITK_SOURCE_VERSION;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* ChunkedVolumeImageIOFactory::GetDescription() const
+{
+  return "Chunked Volume ImageIO Factory, allows the loading of chunked volume images into Insight";
+}
+} // end namespace itk
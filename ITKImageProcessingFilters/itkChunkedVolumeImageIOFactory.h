@@ -0,0 +1,66 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+#ifndef itkChunkedVolumeImageIOFactory_h
+#define itkChunkedVolumeImageIOFactory_h
+
+#include "itkImageIOBase.h"
+#include "itkObjectFactoryBase.h"
+
+namespace itk
+{
+/** \class ChunkedVolumeImageIOFactory
+ * \brief Creates instances of ChunkedVolumeImageIO objects using an object factory.
+ *
+ * \ingroup IOFilters
+ */
+class ChunkedVolumeImageIOFactory : public ObjectFactoryBase
+{
+public:
+  typedef ChunkedVolumeImageIOFactory Self;
+  typedef ObjectFactoryBase Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  virtual const char* GetITKSourceVersion() const ITK_OVERRIDE;
+
+  virtual const char* GetDescription() const ITK_OVERRIDE;
+
+  /** Method for class instantiation. */
+  itkFactorylessNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ChunkedVolumeImageIOFactory, ObjectFactoryBase);
+
+  /** Register one factory of this type  */
+  static void RegisterOneFactory()
+  {
+    ChunkedVolumeImageIOFactory::Pointer factory = ChunkedVolumeImageIOFactory::New();
+    ObjectFactoryBase::RegisterFactoryInternal(factory);
+  }
+
+protected:
+  ChunkedVolumeImageIOFactory();
+  virtual ~ChunkedVolumeImageIOFactory();
+
+private:
+  ChunkedVolumeImageIOFactory(const Self&) ITK_DELETE_FUNCTION;
+  void operator=(const Self&) ITK_DELETE_FUNCTION;
+};
+} // end namespace itk
+
+#endif
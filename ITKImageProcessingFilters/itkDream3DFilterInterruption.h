@@ -4,9 +4,21 @@
 #include "itkCommand.h"
 #include "itkProcessObject.h"
 
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace itk
 {
 
+/**
+ * @brief The Dream3DFilterInterruption class observes the ITK process objects of a
+ * DREAM.3D filter pipeline. It aborts them when the DREAM.3D filter is canceled,
+ * forwards their progress to the DREAM.3D filter and records the wall time spent
+ * in each stage of the pipeline (bridges, casts, filter).
+ */
 class Dream3DFilterInterruption : public Command
 {
 public:
@@ -18,22 +30,108 @@ public:
   itkNewMacro(Dream3DFilterInterruption);
   itkSetObjectMacro(Filter, AbstractFilter);
 
+  /** Stage names and accumulated wall times in seconds, in execution order. */
+  typedef std::vector<std::pair<std::string, double>> StageTimesType;
+
 private:
+  typedef std::chrono::steady_clock ClockType;
+
   AbstractFilter* m_Filter;
+  std::map<const Object*, std::string> m_StageNames;
+  std::map<const Object*, ClockType::time_point> m_StartTimes;
+  StageTimesType m_StageTimes;
+  int m_LastProgress;
+
   Dream3DFilterInterruption()
   {
     m_Filter = ITK_NULLPTR;
+    m_LastProgress = -1;
   }
 
 public:
+  /**
+   * @brief AddStage Observes 'object' as the stage 'name' of the pipeline: progress,
+   * cancellation and execution time. Stages sharing a name are accumulated.
+   */
+  void AddStage(ProcessObject* object, const std::string& name)
+  {
+    m_StageNames[object] = name;
+    object->AddObserver(ProgressEvent(), this);
+    object->AddObserver(StartEvent(), this);
+    object->AddObserver(EndEvent(), this);
+  }
+
+  /**
+   * @brief AddStageTime Adds 'seconds' to the stage 'name', for work that is not done by
+   * an ITK process object.
+   */
+  void AddStageTime(const std::string& name, double seconds)
+  {
+    for(size_t i = 0; i < m_StageTimes.size(); i++)
+    {
+      if(m_StageTimes[i].first == name)
+      {
+        m_StageTimes[i].second += seconds;
+        return;
+      }
+    }
+    m_StageTimes.push_back(std::make_pair(name, seconds));
+  }
+
+  /**
+   * @brief GetStageTimes Returns the wall time spent in each stage
+   */
+  const StageTimesType& GetStageTimes() const
+  {
+    return m_StageTimes;
+  }
+
+  /**
+   * @brief GetTotalTime Returns the wall time spent in all the stages
+   */
+  double GetTotalTime() const
+  {
+    double total = 0.0;
+    for(size_t i = 0; i < m_StageTimes.size(); i++)
+    {
+      total += m_StageTimes[i].second;
+    }
+    return total;
+  }
+
   void Execute(Object* caller, const EventObject& event) override
   {
+    ProcessObject* po = dynamic_cast<ProcessObject*>(caller);
+    if(!po)
+    {
+      return;
+    }
+    if(StartEvent().CheckEvent(&event))
+    {
+      m_StartTimes[caller] = ClockType::now();
+      return;
+    }
+    if(EndEvent().CheckEvent(&event))
+    {
+      std::chrono::duration<double> elapsed = ClockType::now() - m_StartTimes[caller];
+      AddStageTime(m_StageNames[caller], elapsed.count());
+      return;
+    }
     if(m_Filter && m_Filter->getCancel())
     {
-      ProcessObject* po = dynamic_cast<ProcessObject*>(caller);
-      if(po)
+      Execute(po);
+      return;
+    }
+    if(m_Filter)
+    {
+      // Only report changes of at least one percent
+      int progress = static_cast<int>(po->GetProgress() * 100.0f);
+      if(progress != m_LastProgress)
       {
-        Execute(po);
+        m_LastProgress = progress;
+        std::map<const Object*, std::string>::const_iterator stage = m_StageNames.find(caller);
+        QString message = QString::fromStdString(stage != m_StageNames.end() ? stage->second : std::string("Filter"));
+        m_Filter->notifyProgressMessage(m_Filter->getMessagePrefix(), m_Filter->getHumanLabel(), message, progress);
       }
     }
   }
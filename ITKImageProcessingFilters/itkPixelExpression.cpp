@@ -0,0 +1,734 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "itkPixelExpression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <locale>
+#include <sstream>
+
+namespace
+{
+/**
+ * @brief Description of a function that can be called in an expression. Arguments that are not given
+ * take their default value, which must then exist for all the following ones.
+ */
+struct FunctionDescription
+{
+  const char* name;
+  itk::PixelExpression::OperationType operation;
+  unsigned int minimumArguments;
+  unsigned int maximumArguments;
+  double defaults[4];
+};
+
+const FunctionDescription Functions[] = {
+    {"abs", itk::PixelExpression::Abs, 1, 1, {0, 0, 0, 0}},
+    {"sqrt", itk::PixelExpression::Sqrt, 1, 1, {0, 0, 0, 0}},
+    {"square", itk::PixelExpression::Square, 1, 1, {0, 0, 0, 0}},
+    {"exp", itk::PixelExpression::Exp, 1, 1, {0, 0, 0, 0}},
+    {"log", itk::PixelExpression::Log, 1, 1, {0, 0, 0, 0}},
+    {"log10", itk::PixelExpression::Log10, 1, 1, {0, 0, 0, 0}},
+    {"sin", itk::PixelExpression::Sin, 1, 1, {0, 0, 0, 0}},
+    {"cos", itk::PixelExpression::Cos, 1, 1, {0, 0, 0, 0}},
+    {"tan", itk::PixelExpression::Tan, 1, 1, {0, 0, 0, 0}},
+    {"asin", itk::PixelExpression::Asin, 1, 1, {0, 0, 0, 0}},
+    {"acos", itk::PixelExpression::Acos, 1, 1, {0, 0, 0, 0}},
+    {"atan", itk::PixelExpression::Atan, 1, 1, {0, 0, 0, 0}},
+    {"pow", itk::PixelExpression::Power, 2, 2, {0, 0, 0, 0}},
+    {"min", itk::PixelExpression::Minimum, 2, 2, {0, 0, 0, 0}},
+    {"max", itk::PixelExpression::Maximum, 2, 2, {0, 0, 0, 0}},
+    {"clamp", itk::PixelExpression::Clamp, 3, 3, {0, 0, 0, 0}},
+    {"boundedreciprocal", itk::PixelExpression::BoundedReciprocal, 1, 1, {0, 0, 0, 0}},
+    {"shiftscale", itk::PixelExpression::ShiftScale, 1, 3, {0.0, 1.0, 0, 0}},
+    {"sigmoid", itk::PixelExpression::Sigmoid, 1, 5, {1.0, 0.0, 0.0, 1.0}},
+};
+} // end anonymous namespace
+
+namespace itk
+{
+/**
+ * @brief Recursive descent parser of the expressions. Instructions are emitted in postfix order while parsing:
+ *   expression := term (('+' | '-') term)*
+ *   term       := unary (('*' | '/') unary)*
+ *   unary      := ('-' | '+') unary | power
+ *   power      := primary ('^' unary)?
+ *   primary    := number | 'x' | 'pi' | function '(' expression (',' expression)* ')' | '(' expression ')'
+ */
+class PixelExpression::Parser
+{
+public:
+  Parser(PixelExpression& program, const std::string& text)
+  : m_Program(program)
+  , m_Text(text)
+  , m_Position(0)
+  {
+  }
+
+  bool Parse(std::string& errorMessage)
+  {
+    skipSpaces();
+    if(m_Position == m_Text.size())
+    {
+      return fail("The expression is empty", errorMessage);
+    }
+    if(!parseExpression(errorMessage))
+    {
+      return false;
+    }
+    if(m_Position != m_Text.size())
+    {
+      return fail(std::string("Unexpected character '") + m_Text[m_Position] + "'", errorMessage);
+    }
+    return true;
+  }
+
+private:
+  bool fail(const std::string& message, std::string& errorMessage) const
+  {
+    std::ostringstream stream;
+    stream << message << " at position " << m_Position + 1;
+    errorMessage = stream.str();
+    return false;
+  }
+
+  void skipSpaces()
+  {
+    while(m_Position < m_Text.size() && std::isspace(static_cast<unsigned char>(m_Text[m_Position])))
+    {
+      m_Position++;
+    }
+  }
+
+  bool accept(char c)
+  {
+    if(m_Position < m_Text.size() && m_Text[m_Position] == c)
+    {
+      m_Position++;
+      skipSpaces();
+      return true;
+    }
+    return false;
+  }
+
+  bool parseExpression(std::string& errorMessage)
+  {
+    if(!parseTerm(errorMessage))
+    {
+      return false;
+    }
+    while(true)
+    {
+      if(accept('+'))
+      {
+        if(!parseTerm(errorMessage))
+        {
+          return false;
+        }
+        m_Program.Emit(Add);
+      }
+      else if(accept('-'))
+      {
+        if(!parseTerm(errorMessage))
+        {
+          return false;
+        }
+        m_Program.Emit(Subtract);
+      }
+      else
+      {
+        return true;
+      }
+    }
+  }
+
+  bool parseTerm(std::string& errorMessage)
+  {
+    if(!parseUnary(errorMessage))
+    {
+      return false;
+    }
+    while(true)
+    {
+      if(accept('*'))
+      {
+        if(!parseUnary(errorMessage))
+        {
+          return false;
+        }
+        m_Program.Emit(Multiply);
+      }
+      else if(accept('/'))
+      {
+        if(!parseUnary(errorMessage))
+        {
+          return false;
+        }
+        m_Program.Emit(Divide);
+      }
+      else
+      {
+        return true;
+      }
+    }
+  }
+
+  bool parseUnary(std::string& errorMessage)
+  {
+    if(accept('-'))
+    {
+      if(!parseUnary(errorMessage))
+      {
+        return false;
+      }
+      m_Program.Emit(Negate);
+      return true;
+    }
+    if(accept('+'))
+    {
+      return parseUnary(errorMessage);
+    }
+    return parsePower(errorMessage);
+  }
+
+  bool parsePower(std::string& errorMessage)
+  {
+    if(!parsePrimary(errorMessage))
+    {
+      return false;
+    }
+    if(accept('^'))
+    {
+      // Right associative: x^2^3 is x^(2^3)
+      if(!parseUnary(errorMessage))
+      {
+        return false;
+      }
+      m_Program.Emit(Power);
+    }
+    return true;
+  }
+
+  /**
+   * @brief numberLength Returns the length of the decimal number (digits, optional fraction and
+   * exponent) that starts at the current position.
+   */
+  size_t numberLength() const
+  {
+    size_t end = m_Position;
+    const auto skipDigits = [this, &end]() {
+      while(end < m_Text.size() && std::isdigit(static_cast<unsigned char>(m_Text[end])))
+      {
+        end++;
+      }
+    };
+    skipDigits();
+    if(end < m_Text.size() && m_Text[end] == '.')
+    {
+      end++;
+      skipDigits();
+    }
+    if(end < m_Text.size() && (m_Text[end] == 'e' || m_Text[end] == 'E'))
+    {
+      size_t exponent = end + 1;
+      if(exponent < m_Text.size() && (m_Text[exponent] == '+' || m_Text[exponent] == '-'))
+      {
+        exponent++;
+      }
+      if(exponent < m_Text.size() && std::isdigit(static_cast<unsigned char>(m_Text[exponent])))
+      {
+        end = exponent;
+        skipDigits();
+      }
+    }
+    return end - m_Position;
+  }
+
+  bool parsePrimary(std::string& errorMessage)
+  {
+    if(m_Position == m_Text.size())
+    {
+      return fail("Unexpected end of expression", errorMessage);
+    }
+    const char c = m_Text[m_Position];
+    if(std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+    {
+      // Parsed with the C locale: the application locale may use ',' as decimal separator
+      const size_t length = numberLength();
+      std::istringstream stream(m_Text.substr(m_Position, length));
+      stream.imbue(std::locale::classic());
+      double value = 0.0;
+      stream >> value;
+      if(length == 0 || stream.fail())
+      {
+        return fail("Invalid number", errorMessage);
+      }
+      m_Position += length;
+      skipSpaces();
+      m_Program.Emit(PushConstant, value);
+      return true;
+    }
+    if(accept('('))
+    {
+      if(!parseExpression(errorMessage))
+      {
+        return false;
+      }
+      if(!accept(')'))
+      {
+        return fail("Expected ')'", errorMessage);
+      }
+      return true;
+    }
+    if(!std::isalpha(static_cast<unsigned char>(c)) && c != '_')
+    {
+      return fail(std::string("Unexpected character '") + c + "'", errorMessage);
+    }
+    const size_t nameStart = m_Position;
+    while(m_Position < m_Text.size() && (std::isalnum(static_cast<unsigned char>(m_Text[m_Position])) || m_Text[m_Position] == '_'))
+    {
+      m_Position++;
+    }
+    std::string name = m_Text.substr(nameStart, m_Position - nameStart);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char l) { return static_cast<char>(std::tolower(l)); });
+    skipSpaces();
+    if(name == "x")
+    {
+      m_Program.Emit(PushVariable);
+      return true;
+    }
+    if(name == "pi")
+    {
+      m_Program.Emit(PushConstant, 3.14159265358979323846);
+      return true;
+    }
+    const FunctionDescription* function = nullptr;
+    for(const FunctionDescription& description : Functions)
+    {
+      if(name == description.name)
+      {
+        function = &description;
+      }
+    }
+    if(nullptr == function)
+    {
+      m_Position = nameStart;
+      return fail("Unknown name '" + name + "'", errorMessage);
+    }
+    if(!accept('('))
+    {
+      return fail("Expected '(' after '" + name + "'", errorMessage);
+    }
+    unsigned int numberOfArguments = 0;
+    do
+    {
+      if(!parseExpression(errorMessage))
+      {
+        return false;
+      }
+      numberOfArguments++;
+    } while(accept(','));
+    if(!accept(')'))
+    {
+      return fail("Expected ')' or ','", errorMessage);
+    }
+    if(numberOfArguments < function->minimumArguments || numberOfArguments > function->maximumArguments)
+    {
+      std::ostringstream stream;
+      stream << "'" << name << "' takes ";
+      if(function->minimumArguments == function->maximumArguments)
+      {
+        stream << function->minimumArguments;
+      }
+      else
+      {
+        stream << function->minimumArguments << " to " << function->maximumArguments;
+      }
+      stream << " arguments, " << numberOfArguments << " given";
+      return fail(stream.str(), errorMessage);
+    }
+    for(unsigned int i = numberOfArguments; i < function->maximumArguments; i++)
+    {
+      m_Program.Emit(PushConstant, function->defaults[i - 1]);
+    }
+    m_Program.Emit(function->operation);
+    return true;
+  }
+
+  PixelExpression& m_Program;
+  const std::string& m_Text;
+  size_t m_Position;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PixelExpression::PixelExpression()
+: m_StackDepth(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PixelExpression::~PixelExpression() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PixelExpression::Compile(const std::string& expression, std::string& errorMessage)
+{
+  m_Expression = expression;
+  m_Program.clear();
+  m_StackDepth = 0;
+  Parser parser(*this, m_Expression);
+  if(!parser.Parse(errorMessage))
+  {
+    m_Program.clear();
+    return false;
+  }
+  size_t depth = 0;
+  for(const Instruction& instruction : m_Program)
+  {
+    depth = depth + 1 - GetNumberOfArguments(instruction.operation);
+    m_StackDepth = std::max(m_StackDepth, depth);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PixelExpression::IsCompiled() const
+{
+  return !m_Program.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::string& PixelExpression::GetExpression() const
+{
+  return m_Expression;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PixelExpression::IsConstant() const
+{
+  return m_Program.size() == 1 && m_Program[0].operation == PushConstant;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PixelExpression::GetWorkspaceSize() const
+{
+  return m_StackDepth * BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned int PixelExpression::GetNumberOfArguments(OperationType operation)
+{
+  switch(operation)
+  {
+  case PushVariable:
+  case PushConstant:
+    return 0;
+  case Add:
+  case Subtract:
+  case Multiply:
+  case Divide:
+  case Power:
+  case Minimum:
+  case Maximum:
+    return 2;
+  case Clamp:
+  case ShiftScale:
+    return 3;
+  case Sigmoid:
+    return 5;
+  default:
+    return 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PixelExpression::Emit(OperationType operation, double value)
+{
+  const unsigned int numberOfArguments = GetNumberOfArguments(operation);
+  // Arguments are the last instructions of the program if they all are constants.
+  bool constantArguments = (numberOfArguments > 0 && m_Program.size() >= numberOfArguments);
+  for(size_t i = m_Program.size() - (constantArguments ? numberOfArguments : 0); i < m_Program.size(); i++)
+  {
+    constantArguments = constantArguments && m_Program[i].operation == PushConstant;
+  }
+  if(!constantArguments)
+  {
+    Instruction instruction = {operation, value};
+    m_Program.push_back(instruction);
+    return;
+  }
+  double values[5];
+  double* arguments[5];
+  for(unsigned int i = 0; i < numberOfArguments; i++)
+  {
+    values[i] = m_Program[m_Program.size() - numberOfArguments + i].value;
+    arguments[i] = &values[i];
+  }
+  ApplyOperation(operation, arguments, 1);
+  m_Program.resize(m_Program.size() - numberOfArguments);
+  Instruction instruction = {PushConstant, values[0]};
+  m_Program.push_back(instruction);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PixelExpression::ApplyOperation(OperationType operation, double* const* arguments, size_t count)
+{
+  double* a = arguments[0];
+  switch(operation)
+  {
+  case Negate:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = -a[i];
+    }
+    break;
+  case Add:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] += b[i];
+    }
+    break;
+  }
+  case Subtract:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] -= b[i];
+    }
+    break;
+  }
+  case Multiply:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] *= b[i];
+    }
+    break;
+  }
+  case Divide:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] /= b[i];
+    }
+    break;
+  }
+  case Power:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::pow(a[i], b[i]);
+    }
+    break;
+  }
+  case Abs:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::abs(a[i]);
+    }
+    break;
+  case Sqrt:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::sqrt(a[i]);
+    }
+    break;
+  case Square:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = a[i] * a[i];
+    }
+    break;
+  case Exp:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::exp(a[i]);
+    }
+    break;
+  case Log:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::log(a[i]);
+    }
+    break;
+  case Log10:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::log10(a[i]);
+    }
+    break;
+  case Sin:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::sin(a[i]);
+    }
+    break;
+  case Cos:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::cos(a[i]);
+    }
+    break;
+  case Tan:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::tan(a[i]);
+    }
+    break;
+  case Asin:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::asin(a[i]);
+    }
+    break;
+  case Acos:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::acos(a[i]);
+    }
+    break;
+  case Atan:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = std::atan(a[i]);
+    }
+    break;
+  case Minimum:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = (b[i] < a[i] ? b[i] : a[i]);
+    }
+    break;
+  }
+  case Maximum:
+  {
+    const double* b = arguments[1];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = (a[i] < b[i] ? b[i] : a[i]);
+    }
+    break;
+  }
+  case Clamp:
+  {
+    const double* lower = arguments[1];
+    const double* upper = arguments[2];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = (a[i] < lower[i] ? lower[i] : (upper[i] < a[i] ? upper[i] : a[i]));
+    }
+    break;
+  }
+  case BoundedReciprocal:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = 1.0 / (1.0 + a[i]);
+    }
+    break;
+  case ShiftScale:
+  {
+    const double* shift = arguments[1];
+    const double* scale = arguments[2];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = (a[i] + shift[i]) * scale[i];
+    }
+    break;
+  }
+  case Sigmoid:
+  {
+    const double* alpha = arguments[1];
+    const double* beta = arguments[2];
+    const double* minimum = arguments[3];
+    const double* maximum = arguments[4];
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = (maximum[i] - minimum[i]) / (1.0 + std::exp(-(a[i] - beta[i]) / alpha[i])) + minimum[i];
+    }
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PixelExpression::Evaluate(double* values, size_t count, double* workspace) const
+{
+  if(m_Program.empty())
+  {
+    return;
+  }
+  size_t top = 0;
+  double* arguments[5];
+  for(const Instruction& instruction : m_Program)
+  {
+    switch(instruction.operation)
+    {
+    case PushVariable:
+      std::copy(values, values + count, workspace + top * BlockSize);
+      top++;
+      break;
+    case PushConstant:
+      std::fill(workspace + top * BlockSize, workspace + top * BlockSize + count, instruction.value);
+      top++;
+      break;
+    default:
+    {
+      const unsigned int numberOfArguments = GetNumberOfArguments(instruction.operation);
+      top -= numberOfArguments;
+      for(unsigned int i = 0; i < numberOfArguments; i++)
+      {
+        arguments[i] = workspace + (top + i) * BlockSize;
+      }
+      ApplyOperation(instruction.operation, arguments, count);
+      top++;
+    }
+    }
+  }
+  std::copy(workspace, workspace + count, values);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PixelExpression::Evaluate(double value) const
+{
+  std::vector<double> workspace(GetWorkspaceSize());
+  Evaluate(&value, 1, workspace.data());
+  return value;
+}
+} // end of itk namespace
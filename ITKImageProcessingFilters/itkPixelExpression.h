@@ -0,0 +1,135 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#ifndef _ITKPixelExpression_h
+#define _ITKPixelExpression_h
+
+#include <string>
+#include <vector>
+
+namespace itk
+{
+/** \class PixelExpression
+ * \brief Per-pixel arithmetic expression compiled once into a small stack program.
+ *
+ * The expression is written in terms of the pixel value 'x', with numbers, the constant 'pi',
+ * the operators + - * / ^ (power), parentheses and the functions:
+ *   abs, sqrt, square, exp, log, log10, sin, cos, tan, asin, acos, atan, pow(x, y),
+ *   min(a, b), max(a, b), clamp(x, lower, upper), boundedreciprocal(x) = 1 / (1 + x),
+ *   shiftscale(x, shift = 0, scale = 1) = (x + shift) * scale,
+ *   sigmoid(x, alpha = 1, beta = 0, min = 0, max = 1) = (max - min) / (1 + exp(-(x - beta) / alpha)) + min
+ *
+ * Sub-expressions that do not depend on 'x' are folded when the expression is compiled.
+ * The program is evaluated on blocks of BlockSize values: every instruction is a simple loop
+ * over contiguous arrays, which the compiler vectorizes, so the cost of interpreting the program
+ * is paid once per block instead of once per pixel.
+ */
+class PixelExpression
+{
+public:
+  /** Maximum number of values evaluated by one call to Evaluate() */
+  static const size_t BlockSize = 256;
+
+  enum OperationType
+  {
+    PushVariable = 0,
+    PushConstant,
+    Negate,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Power,
+    Abs,
+    Sqrt,
+    Square,
+    Exp,
+    Log,
+    Log10,
+    Sin,
+    Cos,
+    Tan,
+    Asin,
+    Acos,
+    Atan,
+    Minimum,
+    Maximum,
+    Clamp,
+    BoundedReciprocal,
+    ShiftScale,
+    Sigmoid
+  };
+
+  PixelExpression();
+  ~PixelExpression();
+
+  /**
+   * @brief Compile Parses 'expression' and builds its program. Returns false and sets 'errorMessage'
+   * if the expression is not valid, in which case the previous program is cleared.
+   */
+  bool Compile(const std::string& expression, std::string& errorMessage);
+
+  /**
+   * @brief IsCompiled Returns true if a valid expression has been compiled.
+   */
+  bool IsCompiled() const;
+
+  /**
+   * @brief GetExpression Returns the last expression given to Compile()
+   */
+  const std::string& GetExpression() const;
+
+  /**
+   * @brief IsConstant Returns true if the compiled expression does not depend on 'x'.
+   */
+  bool IsConstant() const;
+
+  /**
+   * @brief GetWorkspaceSize Returns the number of doubles of the workspace given to Evaluate()
+   */
+  size_t GetWorkspaceSize() const;
+
+  /**
+   * @brief Evaluate Replaces the 'count' (at most BlockSize) values of 'values' by the result of the
+   * expression. 'workspace' holds GetWorkspaceSize() doubles; each thread must use its own.
+   */
+  void Evaluate(double* values, size_t count, double* workspace) const;
+
+  /**
+   * @brief Evaluate Returns the result of the expression for a single value. Convenient, but slow.
+   */
+  double Evaluate(double value) const;
+
+private:
+  struct Instruction
+  {
+    OperationType operation;
+    double value;
+  };
+
+  class Parser;
+
+  /**
+   * @brief ApplyOperation Applies 'operation' element-wise to the 'count' values of its arguments,
+   * stored in 'arguments'. The result is written in the first argument.
+   */
+  static void ApplyOperation(OperationType operation, double* const* arguments, size_t count);
+
+  /**
+   * @brief GetNumberOfArguments Returns the number of values 'operation' pops from the stack.
+   */
+  static unsigned int GetNumberOfArguments(OperationType operation);
+
+  /**
+   * @brief Emit Appends 'operation' to the program, folding it if all its arguments are constants.
+   */
+  void Emit(OperationType operation, double value = 0.0);
+
+  std::string m_Expression;
+  std::vector<Instruction> m_Program;
+  size_t m_StackDepth;
+};
+} // end of itk namespace
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef _ITKPixelExpressionImageFilter_h
+#define _ITKPixelExpressionImageFilter_h
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkPixelExpression.h"
+#include "itkInPlaceImageFilter.h"
+
+namespace itk
+{
+/** \class PixelExpressionImageFilter
+ * \brief Computes each output pixel by evaluating a compiled PixelExpression on the input pixel.
+ *
+ * All the operations of the expression are applied in a single pass over the image: each scan line
+ * is converted to double and evaluated in blocks of PixelExpression::BlockSize pixels. The result is
+ * clamped to the range of the output pixel type and NaN values are written as 0 in integer images.
+ * Only scalar images are supported. The filter can run in place.
+ */
+template <typename TInputImage, typename TOutputImage> class PixelExpressionImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+{
+public:
+  /** Standard class typedefs. */
+  typedef PixelExpressionImageFilter Self;
+  typedef InPlaceImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  typedef typename TInputImage::PixelType InputPixelType;
+  typedef typename TOutputImage::PixelType OutputPixelType;
+  typedef typename TOutputImage::RegionType OutputImageRegionType;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+  itkTypeMacro(PixelExpressionImageFilter, InPlaceImageFilter);
+
+  /** Sets the expression evaluated on each pixel. It must be compiled. */
+  void SetExpression(const PixelExpression& expression);
+  const PixelExpression& GetExpression() const;
+
+protected:
+  PixelExpressionImageFilter();
+  virtual ~PixelExpressionImageFilter();
+
+  virtual void BeforeThreadedGenerateData() ITK_OVERRIDE;
+  virtual void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) ITK_OVERRIDE;
+
+  /** Converts a value of the expression to the output pixel type */
+  static OutputPixelType ConvertValue(double value);
+
+private:
+  PixelExpressionImageFilter(const PixelExpressionImageFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PixelExpressionImageFilter&);                    // Operator '=' Not Implemented
+
+  PixelExpression m_Expression;
+}; // end of class PixelExpressionImageFilter
+} // end of itk namespace
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkPixelExpressionImageFilter.hxx"
+#endif
+
+#endif
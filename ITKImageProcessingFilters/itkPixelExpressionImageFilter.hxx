@@ -0,0 +1,126 @@
+#ifndef _ITKPixelExpressionImageFilter_hxx
+#define _ITKPixelExpressionImageFilter_hxx
+
+#include "itkPixelExpressionImageFilter.h"
+
+#include "itkImageScanlineConstIterator.h"
+#include "itkNumericTraits.h"
+#include "itkProgressReporter.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::PixelExpressionImageFilter()
+{
+  this->InPlaceOff();
+}
+
+template <typename TInputImage, typename TOutputImage>
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::~PixelExpressionImageFilter()
+{
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::SetExpression(const PixelExpression& expression)
+{
+  m_Expression = expression;
+  this->Modified();
+}
+
+template <typename TInputImage, typename TOutputImage>
+const PixelExpression&
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::GetExpression() const
+{
+  return m_Expression;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::BeforeThreadedGenerateData()
+{
+  if(!m_Expression.IsCompiled())
+  {
+    itkExceptionMacro("No compiled expression has been set");
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+typename PixelExpressionImageFilter<TInputImage, TOutputImage>::OutputPixelType
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::ConvertValue(double value)
+{
+  if(!std::numeric_limits<OutputPixelType>::is_integer)
+  {
+    return static_cast<OutputPixelType>(value);
+  }
+  if(value != value)
+  {
+    return OutputPixelType(0);
+  }
+  if(value <= static_cast<double>(NumericTraits<OutputPixelType>::NonpositiveMin()))
+  {
+    return NumericTraits<OutputPixelType>::NonpositiveMin();
+  }
+  if(value >= static_cast<double>(NumericTraits<OutputPixelType>::max()))
+  {
+    return NumericTraits<OutputPixelType>::max();
+  }
+  return static_cast<OutputPixelType>(value);
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+PixelExpressionImageFilter<TInputImage, TOutputImage>
+::ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId)
+{
+  const TInputImage* inputPtr = this->GetInput();
+  TOutputImage* outputPtr = this->GetOutput(0);
+
+  const size_t lineSize = outputRegionForThread.GetSize(0);
+  if(lineSize == 0)
+  {
+    return;
+  }
+  ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels() / lineSize);
+
+  // Pixels along the first axis are contiguous: each scan line is converted to double and evaluated
+  // block by block. When running in place, a block is read before being overwritten.
+  std::vector<double> values(PixelExpression::BlockSize);
+  std::vector<double> workspace(m_Expression.GetWorkspaceSize());
+  ImageScanlineConstIterator<TInputImage> inputIt(inputPtr, outputRegionForThread);
+  while(!inputIt.IsAtEnd())
+  {
+    const InputPixelType* input = &inputPtr->GetPixel(inputIt.GetIndex());
+    OutputPixelType* output = &outputPtr->GetPixel(inputIt.GetIndex());
+    for(size_t start = 0; start < lineSize; start += PixelExpression::BlockSize)
+    {
+      const size_t count = std::min<size_t>(PixelExpression::BlockSize, lineSize - start);
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = static_cast<double>(input[start + i]);
+      }
+      m_Expression.Evaluate(values.data(), count, workspace.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        output[start + i] = ConvertValue(values[i]);
+      }
+    }
+    inputIt.NextLine();
+    progress.CompletedPixel();
+  }
+}
+
+} // end of itk namespace
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef _ITKReadRegion_h
+#define _ITKReadRegion_h
+
+#include <QString>
+#include <QVector>
+
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+
+#include <itkImageIOBase.h>
+#include <itkImageIORegion.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ITKDream3DHelper
+{
+
+/**
+ * @brief The ReadRegion struct describes the part of an image that is imported by a reader:
+ * a box of the file, given by its start index and its size, sampled every 'stride' pixels
+ * along each axis.
+ */
+struct ReadRegion
+{
+  size_t start[3];
+  size_t size[3];
+  size_t stride[3];
+
+  /**
+   * @brief GetOutputSize Returns the number of pixels imported along 'axis'
+   */
+  size_t GetOutputSize(unsigned int axis) const
+  {
+    return (size[axis] + stride[axis] - 1) / stride[axis];
+  }
+
+  /**
+   * @brief IsFullImage Returns true if the region is the whole image 'dims' without any stride,
+   * in which case the readers keep their original code path.
+   */
+  bool IsFullImage(const size_t dims[3]) const
+  {
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      if(start[i] != 0 || size[i] != dims[i] || stride[i] != 1)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief ComputeReadRegion Checks the region parameters of a reader against the dimensions 'dims'
+ * of the image and fills 'region'. A size of 0 along an axis selects all the pixels from the start
+ * index to the end of that axis. Returns false and sets 'errorMessage' if the region does not fit
+ * in the image.
+ */
+inline bool ComputeReadRegion(const IntVec3_t& start, const IntVec3_t& size, const IntVec3_t& stride, const size_t dims[3], ReadRegion& region, QString& errorMessage)
+{
+  const int starts[3] = {start.x, start.y, start.z};
+  const int sizes[3] = {size.x, size.y, size.z};
+  const int strides[3] = {stride.x, stride.y, stride.z};
+  const char* axes[3] = {"X", "Y", "Z"};
+  for(unsigned int i = 0; i < 3; i++)
+  {
+    if(strides[i] < 1)
+    {
+      errorMessage = QString("The stride along %1 must be at least 1.").arg(axes[i]);
+      return false;
+    }
+    if(starts[i] < 0 || sizes[i] < 0 || static_cast<size_t>(starts[i]) >= dims[i])
+    {
+      errorMessage = QString("The region start along %1 (%2) must be between 0 and %3.").arg(axes[i]).arg(starts[i]).arg(dims[i] - 1);
+      return false;
+    }
+    region.start[i] = static_cast<size_t>(starts[i]);
+    region.size[i] = (sizes[i] == 0 ? dims[i] - region.start[i] : static_cast<size_t>(sizes[i]));
+    region.stride[i] = static_cast<size_t>(strides[i]);
+    if(region.start[i] + region.size[i] > dims[i])
+    {
+      errorMessage = QString("The region along %1 (start %2, size %3) exceeds the image size (%4).").arg(axes[i]).arg(region.start[i]).arg(region.size[i]).arg(dims[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief GetRequestedIORegion Returns the box of 'region' as an ImageIORegion of the dimension of
+ * the file read by 'imageIO'. Axes of the file beyond the third one are read at index 0.
+ */
+inline itk::ImageIORegion GetRequestedIORegion(const itk::ImageIOBase* imageIO, const ReadRegion& region)
+{
+  const unsigned int dimension = imageIO->GetNumberOfDimensions();
+  itk::ImageIORegion ioRegion(dimension);
+  for(unsigned int i = 0; i < dimension; i++)
+  {
+    ioRegion.SetIndex(i, (i < 3 ? region.start[i] : 0));
+    ioRegion.SetSize(i, (i < 3 ? region.size[i] : 1));
+  }
+  return ioRegion;
+}
+
+/**
+ * @brief GetStreamableIORegion Enables streamed reading on 'imageIO' and returns the box it decodes
+ * to read 'requested'. Without streamed reading, the ImageIOs that can stream (uncompressed MetaImage,
+ * MRC, VTK, ...) decode the whole image.
+ */
+inline itk::ImageIORegion GetStreamableIORegion(itk::ImageIOBase* imageIO, const itk::ImageIORegion& requested)
+{
+  imageIO->SetUseStreamedReading(true);
+  return imageIO->GenerateStreamableReadRegionFromRequestedRegion(requested);
+}
+
+/**
+ * @brief CopyRegionSamples Copies the pixels of 'region' from 'source', the buffer of the box
+ * 'sourceRegion' of the file, to the contiguous buffer 'destination'. Pixels are made of
+ * 'numberOfComponents' interleaved values.
+ */
+template <typename T> void CopyRegionSamples(const T* source, const itk::ImageIORegion& sourceRegion, const ReadRegion& region, size_t numberOfComponents, T* destination)
+{
+  size_t sourceIndex[3] = {0, 0, 0};
+  size_t sourceOffsets[3] = {numberOfComponents, 0, 0};
+  size_t sourceSize[3] = {1, 1, 1};
+  for(unsigned int i = 0; i < std::min(3u, sourceRegion.GetImageDimension()); i++)
+  {
+    sourceIndex[i] = static_cast<size_t>(sourceRegion.GetIndex(i));
+    sourceSize[i] = sourceRegion.GetSize(i);
+  }
+  sourceOffsets[1] = sourceOffsets[0] * sourceSize[0];
+  sourceOffsets[2] = sourceOffsets[1] * sourceSize[1];
+  const size_t outputSize[3] = {region.GetOutputSize(0), region.GetOutputSize(1), region.GetOutputSize(2)};
+  for(size_t z = 0; z < outputSize[2]; z++)
+  {
+    const size_t offsetZ = (region.start[2] + z * region.stride[2] - sourceIndex[2]) * sourceOffsets[2];
+    for(size_t y = 0; y < outputSize[1]; y++)
+    {
+      const T* row = source + offsetZ + (region.start[1] + y * region.stride[1] - sourceIndex[1]) * sourceOffsets[1] + (region.start[0] - sourceIndex[0]) * sourceOffsets[0];
+      if(region.stride[0] == 1)
+      {
+        destination = std::copy(row, row + outputSize[0] * numberOfComponents, destination);
+        continue;
+      }
+      for(size_t x = 0; x < outputSize[0]; x++)
+      {
+        const T* pixel = row + x * region.stride[0] * numberOfComponents;
+        destination = std::copy(pixel, pixel + numberOfComponents, destination);
+      }
+    }
+  }
+}
+
+/**
+ * @brief ReadRegionFromIO Reads the pixels of 'region' from the file opened by 'imageIO' into the
+ * contiguous buffer 'destination'. The box of the region is requested through the streaming API of
+ * the ImageIO: formats that can stream (uncompressed MetaImage, MRC, VTK, ...) only decode that box,
+ * the other ones (e.g. NRRD, compressed MetaImage) decode the whole image into 'buffer'. The box is
+ * decoded straight into 'destination' when there is no stride and the ImageIO returns exactly the
+ * requested box.
+ */
+template <typename T> void ReadRegionFromIO(itk::ImageIOBase* imageIO, const ReadRegion& region, size_t numberOfComponents, std::vector<T>& buffer, T* destination)
+{
+  const itk::ImageIORegion requested = GetRequestedIORegion(imageIO, region);
+  const itk::ImageIORegion streamable = GetStreamableIORegion(imageIO, requested);
+  imageIO->SetIORegion(streamable);
+  if(streamable == requested && region.stride[0] == 1 && region.stride[1] == 1 && region.stride[2] == 1)
+  {
+    imageIO->Read(destination);
+    return;
+  }
+  buffer.resize(streamable.GetNumberOfPixels() * numberOfComponents);
+  imageIO->Read(buffer.data());
+  CopyRegionSamples<T>(buffer.data(), streamable, region, numberOfComponents, destination);
+}
+
+/**
+ * @brief ReadConvertedComponents Reads the pixels of 'region' in the component type TInput of the file
+ * and casts each component to TOutput into 'destination'.
+ */
+template <typename TInput, typename TOutput> void ReadConvertedComponents(itk::ImageIOBase* imageIO, const ReadRegion& region, size_t numberOfComponents, TOutput* destination)
+{
+  const size_t numberOfValues = region.GetOutputSize(0) * region.GetOutputSize(1) * region.GetOutputSize(2) * numberOfComponents;
+  std::vector<TInput> buffer;
+  std::vector<TInput> values(numberOfValues);
+  ReadRegionFromIO<TInput>(imageIO, region, numberOfComponents, buffer, values.data());
+  std::transform(values.begin(), values.end(), destination, [](TInput value) { return static_cast<TOutput>(value); });
+}
+
+/**
+ * @brief ReadConvertedRegionFromIO Same as ReadRegionFromIO() for a file whose component type is not
+ * TOutput: the components are cast at run time, like the ITK readers do, without instantiating a reader
+ * for the pixel type. Returns false if the component type of the file is not supported.
+ */
+template <typename TOutput> bool ReadConvertedRegionFromIO(itk::ImageIOBase* imageIO, const ReadRegion& region, size_t numberOfComponents, TOutput* destination)
+{
+  switch(imageIO->GetComponentType())
+  {
+  case itk::ImageIOBase::UCHAR:
+    ReadConvertedComponents<unsigned char, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::CHAR:
+    ReadConvertedComponents<char, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::USHORT:
+    ReadConvertedComponents<unsigned short, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::SHORT:
+    ReadConvertedComponents<short, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::UINT:
+    ReadConvertedComponents<unsigned int, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::INT:
+    ReadConvertedComponents<int, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::ULONG:
+    ReadConvertedComponents<unsigned long, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::LONG:
+    ReadConvertedComponents<long, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::FLOAT:
+    ReadConvertedComponents<float, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  case itk::ImageIOBase::DOUBLE:
+    ReadConvertedComponents<double, TOutput>(imageIO, region, numberOfComponents, destination);
+    return true;
+  default:
+    return false;
+  }
+}
+
+} // end of ITKDream3DHelper namespace
+
+#endif
@@ -0,0 +1,750 @@
+#include "itkUnaryMathKernels.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ITKIP_SIMD_X86_64 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// Kernels for instruction sets beyond the baseline of the build are compiled for their own target,
+// and only called if the processor supports them.
+#if defined(__GNUC__) || defined(__clang__)
+#define ITKIP_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+#define ITKIP_TARGET(instructionSet)
+#endif
+
+namespace
+{
+using ITKDream3DHelper::SIMDInstructionSet;
+using ITKDream3DHelper::UnaryMathOperation;
+
+// -----------------------------------------------------------------------------
+// Same computations as the ITK functors, one value at a time
+// -----------------------------------------------------------------------------
+template <typename T> void ScalarKernel(UnaryMathOperation operation, const T* input, T* output, size_t count)
+{
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = std::abs(input[i]);
+    }
+    break;
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<T>(std::sqrt(static_cast<double>(input[i])));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < count; i++)
+    {
+      const double value = static_cast<double>(input[i]);
+      output[i] = static_cast<T>(value * value);
+    }
+    break;
+  case UnaryMathOperation::Exp:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<T>(std::exp(static_cast<double>(input[i])));
+    }
+    break;
+  case UnaryMathOperation::ExpNegative:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<T>(std::exp(-static_cast<double>(input[i])));
+    }
+    break;
+  case UnaryMathOperation::Log:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<T>(std::log(static_cast<double>(input[i])));
+    }
+    break;
+  case UnaryMathOperation::Sin:
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<T>(std::sin(static_cast<double>(input[i])));
+    }
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Returns true if 'operation' has an explicit SIMD implementation. The square root of a float
+// computed in double and rounded to float is the correctly rounded float square root, and the
+// product of two floats is exact in double: the SIMD kernels give the same results as ITK.
+// Exp, ExpNegative, Log and Sin of floats are evaluated in double precision with a relative error
+// below 1e-15, and rounded to float: they may differ from ITK by 1 ULP at most, when the exact
+// result is within 1e-15 of halfway between two floats. No float input does in practice: the
+// kernels were checked against ITK on all the 2^32 float values. Double arrays keep the standard
+// library for these operations.
+// -----------------------------------------------------------------------------
+bool HasSIMDKernel(UnaryMathOperation, const float*)
+{
+  return true;
+}
+
+bool HasSIMDKernel(UnaryMathOperation operation, const double*)
+{
+  return operation == UnaryMathOperation::Abs || operation == UnaryMathOperation::Sqrt || operation == UnaryMathOperation::Square;
+}
+
+#if defined(ITKIP_SIMD_X86_64)
+// -----------------------------------------------------------------------------
+// Constants of the double precision exp, log and sin of the float kernels
+// -----------------------------------------------------------------------------
+// Adding then subtracting 1.5 * 2^52 rounds a double to the nearest integer, which is also
+// left in the low bits of the sum.
+const double RoundingMagic = 6755399441055744.0;
+const double Log2E = 1.4426950408889634074;
+// ln(2) split in a part whose products by integers below 2^21 are exact, and the rest
+const double Ln2High = 6.93147180369123816490e-01;
+const double Ln2Low = 1.90821492927058770002e-10;
+// Beyond these bounds exp() overflows or underflows in float anyway
+const double ExpMin = -708.0;
+const double ExpMax = 709.0;
+// exp(r) for |r| <= ln(2) / 2: Taylor series up to r^13, from the highest degree
+const double ExpCoefficients[] = {1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0,
+                                  1.0 / 720.0,        1.0 / 120.0,        1.0 / 24.0,       1.0 / 6.0,        0.5,              1.0,          1.0};
+const double Sqrt2 = 1.41421356237309504880;
+const double TwoPow52 = 4503599627370496.0;
+// log(m) = 2 s (1 + z / 3 + z^2 / 5 + ...) with s = (m - 1) / (m + 1) and z = s^2 <= 0.0295: terms up to z^11
+const double LogCoefficients[] = {1.0 / 23.0, 1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0, 1.0 / 11.0, 1.0 / 9.0, 1.0 / 7.0, 1.0 / 5.0, 1.0 / 3.0};
+const double TwoOverPi = 6.36619772367581382433e-01;
+// pi / 2 split in three parts of 33 bits: the products by integers below 2^20 are exact
+const double PiOver2Part1 = 1.57079632673412561417e+00;
+const double PiOver2Part2 = 6.07710050650619224932e-11;
+const double PiOver2Part3 = 2.02226624879595063154e-21;
+// Largest |x| reduced exactly with these parts (2^19 * pi / 2). Larger values use std::sin.
+const double SinMax = 823549.0;
+// sin(r) = r + r z (S1 + z S2 + ...) and cos(r) = 1 + z (C1 + z C2 + ...) for |r| <= pi / 4 and
+// z = r^2: Taylor series up to r^15 and r^16, from the highest degree
+const double SinCoefficients[] = {-1.0 / 1307674368000.0, 1.0 / 6227020800.0, -1.0 / 39916800.0, 1.0 / 362880.0, -1.0 / 5040.0, 1.0 / 120.0, -1.0 / 6.0};
+const double CosCoefficients[] = {1.0 / 20922789888000.0, -1.0 / 87178291200.0, 1.0 / 479001600.0, -1.0 / 3628800.0, 1.0 / 40320.0, -1.0 / 720.0, 1.0 / 24.0, -0.5};
+
+// -----------------------------------------------------------------------------
+// SSE2 double precision sine, two values at a time. With two values per instruction, exp()
+// and log() are not faster than the standard library.
+// -----------------------------------------------------------------------------
+inline __m128d SelectSSE2(__m128d mask, __m128d a, __m128d b)
+{
+  return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+template <size_t N> inline __m128d PolynomialSSE2(const double (&coefficients)[N], __m128d x)
+{
+  __m128d result = _mm_set1_pd(coefficients[0]);
+  for(size_t i = 1; i < N; i++)
+  {
+    result = _mm_add_pd(_mm_mul_pd(result, x), _mm_set1_pd(coefficients[i]));
+  }
+  return result;
+}
+
+// |x| <= SinMax
+inline __m128d SinSSE2(__m128d x)
+{
+  const __m128d magic = _mm_set1_pd(RoundingMagic);
+  // sin(x) = +/- sin(r) or +/- cos(r) with x = k pi / 2 + r, depending on k modulo 4
+  const __m128d t = _mm_add_pd(_mm_mul_pd(x, _mm_set1_pd(TwoOverPi)), magic);
+  const __m128d k = _mm_sub_pd(t, magic);
+  __m128d r = _mm_sub_pd(x, _mm_mul_pd(k, _mm_set1_pd(PiOver2Part1)));
+  r = _mm_sub_pd(r, _mm_mul_pd(k, _mm_set1_pd(PiOver2Part2)));
+  r = _mm_sub_pd(r, _mm_mul_pd(k, _mm_set1_pd(PiOver2Part3)));
+  const __m128d z = _mm_mul_pd(r, r);
+  const __m128d sinR = _mm_add_pd(r, _mm_mul_pd(_mm_mul_pd(r, z), PolynomialSSE2(SinCoefficients, z)));
+  const __m128d cosR = _mm_add_pd(_mm_set1_pd(1.0), _mm_mul_pd(z, PolynomialSSE2(CosCoefficients, z)));
+  const __m128i quadrant = _mm_castpd_si128(t);
+  const __m128d twoPow52 = _mm_set1_pd(TwoPow52);
+  const __m128d odd = _mm_cmpneq_pd(_mm_castsi128_pd(_mm_or_si128(_mm_and_si128(quadrant, _mm_set1_epi64x(1)), _mm_castpd_si128(twoPow52))), twoPow52);
+  const __m128i sign = _mm_slli_epi64(_mm_and_si128(quadrant, _mm_set1_epi64x(2)), 62);
+  return _mm_xor_pd(SelectSSE2(odd, cosR, sinR), _mm_castsi128_pd(sign));
+}
+
+// -----------------------------------------------------------------------------
+// Sine of floats, four values at a time. Returns the number of values processed.
+// -----------------------------------------------------------------------------
+size_t SinKernelSSE2(const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 4;
+  const __m128d sinMax = _mm_set1_pd(SinMax);
+  const __m128d signMask = _mm_set1_pd(-0.0);
+  for(size_t i = 0; i < end; i += 4)
+  {
+    const __m128 values = _mm_loadu_ps(input + i);
+    const __m128d low = _mm_cvtps_pd(values);
+    const __m128d high = _mm_cvtps_pd(_mm_movehl_ps(values, values));
+    // Also true for NaN, which std::sin handles
+    if(_mm_movemask_pd(_mm_or_pd(_mm_cmpnle_pd(_mm_andnot_pd(signMask, low), sinMax), _mm_cmpnle_pd(_mm_andnot_pd(signMask, high), sinMax))) != 0)
+    {
+      ScalarKernel<float>(UnaryMathOperation::Sin, input + i, output + i, 4);
+      continue;
+    }
+    _mm_storeu_ps(output + i, _mm_movelh_ps(_mm_cvtpd_ps(SinSSE2(low)), _mm_cvtpd_ps(SinSSE2(high))));
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+// SSE2: baseline of x86-64. Returns the number of values processed.
+// -----------------------------------------------------------------------------
+size_t KernelSSE2(UnaryMathOperation operation, const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 4;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for(size_t i = 0; i < end; i += 4)
+    {
+      _mm_storeu_ps(output + i, _mm_andnot_ps(signMask, _mm_loadu_ps(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 4)
+    {
+      _mm_storeu_ps(output + i, _mm_sqrt_ps(_mm_loadu_ps(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 4)
+    {
+      const __m128 value = _mm_loadu_ps(input + i);
+      _mm_storeu_ps(output + i, _mm_mul_ps(value, value));
+    }
+    break;
+  case UnaryMathOperation::Sin:
+    return SinKernelSSE2(input, output, count);
+  default:
+    return 0;
+  }
+  return end;
+}
+
+size_t KernelSSE2(UnaryMathOperation operation, const double* input, double* output, size_t count)
+{
+  const size_t end = count - count % 2;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    for(size_t i = 0; i < end; i += 2)
+    {
+      _mm_storeu_pd(output + i, _mm_andnot_pd(signMask, _mm_loadu_pd(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 2)
+    {
+      _mm_storeu_pd(output + i, _mm_sqrt_pd(_mm_loadu_pd(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 2)
+    {
+      const __m128d value = _mm_loadu_pd(input + i);
+      _mm_storeu_pd(output + i, _mm_mul_pd(value, value));
+    }
+    break;
+  default:
+    return 0;
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+// AVX2 double precision functions, four values at a time
+// -----------------------------------------------------------------------------
+template <size_t N> ITKIP_TARGET("avx2") inline __m256d PolynomialAVX2(const double (&coefficients)[N], __m256d x)
+{
+  __m256d result = _mm256_set1_pd(coefficients[0]);
+  for(size_t i = 1; i < N; i++)
+  {
+    result = _mm256_add_pd(_mm256_mul_pd(result, x), _mm256_set1_pd(coefficients[i]));
+  }
+  return result;
+}
+
+ITKIP_TARGET("avx2") inline __m256d ExpAVX2(__m256d x)
+{
+  const __m256d magic = _mm256_set1_pd(RoundingMagic);
+  const __m256d clamped = _mm256_max_pd(_mm256_min_pd(x, _mm256_set1_pd(ExpMax)), _mm256_set1_pd(ExpMin));
+  // exp(x) = 2^n exp(r) with x = n ln(2) + r
+  const __m256d t = _mm256_add_pd(_mm256_mul_pd(clamped, _mm256_set1_pd(Log2E)), magic);
+  const __m256d n = _mm256_sub_pd(t, magic);
+  __m256d r = _mm256_sub_pd(clamped, _mm256_mul_pd(n, _mm256_set1_pd(Ln2High)));
+  r = _mm256_sub_pd(r, _mm256_mul_pd(n, _mm256_set1_pd(Ln2Low)));
+  const __m256i exponent = _mm256_slli_epi64(_mm256_add_epi64(_mm256_castpd_si256(t), _mm256_set1_epi64x(1023)), 52);
+  const __m256d result = _mm256_mul_pd(PolynomialAVX2(ExpCoefficients, r), _mm256_castsi256_pd(exponent));
+  // The clamping lost the NaN inputs
+  return _mm256_blendv_pd(result, x, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+}
+
+ITKIP_TARGET("avx2") inline __m256d LogAVX2(__m256d x)
+{
+  const __m256d one = _mm256_set1_pd(1.0);
+  const __m256i bits = _mm256_castpd_si256(x);
+  // x = m 2^e with m in [sqrt(2) / 2, sqrt(2))
+  __m256d m = _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL))), one);
+  __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(TwoPow52)))),
+                            _mm256_set1_pd(TwoPow52 + 1023.0));
+  const __m256d above = _mm256_cmp_pd(m, _mm256_set1_pd(Sqrt2), _CMP_GE_OQ);
+  m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), above);
+  e = _mm256_add_pd(e, _mm256_and_pd(above, one));
+  const __m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+  const __m256d z = _mm256_mul_pd(s, s);
+  const __m256d twoS = _mm256_add_pd(s, s);
+  const __m256d logM = _mm256_add_pd(twoS, _mm256_mul_pd(twoS, _mm256_mul_pd(z, PolynomialAVX2(LogCoefficients, z))));
+  __m256d result = _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Ln2High)), _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Ln2Low)), logM));
+  // log(+inf) = +inf, log(0) = -inf, log(x < 0) = NaN, log(NaN) = NaN
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d infinity = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+  result = _mm256_blendv_pd(result, infinity, _mm256_cmp_pd(x, infinity, _CMP_EQ_OQ));
+  result = _mm256_blendv_pd(result, _mm256_sub_pd(zero, infinity), _mm256_cmp_pd(x, zero, _CMP_EQ_OQ));
+  result = _mm256_blendv_pd(result, _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN()), _mm256_cmp_pd(x, zero, _CMP_LT_OQ));
+  return _mm256_blendv_pd(result, x, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+}
+
+// |x| <= SinMax. Same algorithm as SinSSE2().
+ITKIP_TARGET("avx2") inline __m256d SinAVX2(__m256d x)
+{
+  const __m256d magic = _mm256_set1_pd(RoundingMagic);
+  const __m256d t = _mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(TwoOverPi)), magic);
+  const __m256d k = _mm256_sub_pd(t, magic);
+  __m256d r = _mm256_sub_pd(x, _mm256_mul_pd(k, _mm256_set1_pd(PiOver2Part1)));
+  r = _mm256_sub_pd(r, _mm256_mul_pd(k, _mm256_set1_pd(PiOver2Part2)));
+  r = _mm256_sub_pd(r, _mm256_mul_pd(k, _mm256_set1_pd(PiOver2Part3)));
+  const __m256d z = _mm256_mul_pd(r, r);
+  const __m256d sinR = _mm256_add_pd(r, _mm256_mul_pd(_mm256_mul_pd(r, z), PolynomialAVX2(SinCoefficients, z)));
+  const __m256d cosR = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(z, PolynomialAVX2(CosCoefficients, z)));
+  const __m256i quadrant = _mm256_castpd_si256(t);
+  const __m256i odd = _mm256_cmpeq_epi64(_mm256_and_si256(quadrant, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1));
+  const __m256i sign = _mm256_slli_epi64(_mm256_and_si256(quadrant, _mm256_set1_epi64x(2)), 62);
+  return _mm256_xor_pd(_mm256_blendv_pd(sinR, cosR, _mm256_castsi256_pd(odd)), _mm256_castsi256_pd(sign));
+}
+
+ITKIP_TARGET("avx2") inline __m256d EvaluateAVX2(UnaryMathOperation operation, __m256d x)
+{
+  switch(operation)
+  {
+  case UnaryMathOperation::Exp:
+    return ExpAVX2(x);
+  case UnaryMathOperation::ExpNegative:
+    return ExpAVX2(_mm256_xor_pd(x, _mm256_set1_pd(-0.0)));
+  case UnaryMathOperation::Log:
+    return LogAVX2(x);
+  default:
+    return SinAVX2(x);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Exp, ExpNegative, Log and Sin of floats, eight values at a time. Returns the number of
+// values processed.
+// -----------------------------------------------------------------------------
+ITKIP_TARGET("avx2") size_t TranscendentalAVX2(UnaryMathOperation operation, const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 8;
+  const __m256 sinMax = _mm256_set1_ps(static_cast<float>(SinMax));
+  const __m256 signMask = _mm256_set1_ps(-0.0f);
+  for(size_t i = 0; i < end; i += 8)
+  {
+    const __m256 values = _mm256_loadu_ps(input + i);
+    // Also true for NaN, which std::sin handles
+    if(operation == UnaryMathOperation::Sin && _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, values), sinMax, _CMP_NLE_UQ)) != 0)
+    {
+      ScalarKernel<float>(operation, input + i, output + i, 8);
+      continue;
+    }
+    const __m128 low = _mm256_cvtpd_ps(EvaluateAVX2(operation, _mm256_cvtps_pd(_mm256_castps256_ps128(values))));
+    const __m128 high = _mm256_cvtpd_ps(EvaluateAVX2(operation, _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1))));
+    _mm256_storeu_ps(output + i, _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1));
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+// AVX2. Returns the number of values processed.
+// -----------------------------------------------------------------------------
+ITKIP_TARGET("avx2") size_t KernelAVX2(UnaryMathOperation operation, const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 8;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    for(size_t i = 0; i < end; i += 8)
+    {
+      _mm256_storeu_ps(output + i, _mm256_andnot_ps(signMask, _mm256_loadu_ps(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 8)
+    {
+      _mm256_storeu_ps(output + i, _mm256_sqrt_ps(_mm256_loadu_ps(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 8)
+    {
+      const __m256 value = _mm256_loadu_ps(input + i);
+      _mm256_storeu_ps(output + i, _mm256_mul_ps(value, value));
+    }
+    break;
+  default:
+    return TranscendentalAVX2(operation, input, output, count);
+  }
+  return end;
+}
+
+ITKIP_TARGET("avx2") size_t KernelAVX2(UnaryMathOperation operation, const double* input, double* output, size_t count)
+{
+  const size_t end = count - count % 4;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    for(size_t i = 0; i < end; i += 4)
+    {
+      _mm256_storeu_pd(output + i, _mm256_andnot_pd(signMask, _mm256_loadu_pd(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 4)
+    {
+      _mm256_storeu_pd(output + i, _mm256_sqrt_pd(_mm256_loadu_pd(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 4)
+    {
+      const __m256d value = _mm256_loadu_pd(input + i);
+      _mm256_storeu_pd(output + i, _mm256_mul_pd(value, value));
+    }
+    break;
+  default:
+    return 0;
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+// AVX-512 double precision functions, eight values at a time. Same algorithms as the AVX2 ones.
+// -----------------------------------------------------------------------------
+template <size_t N> ITKIP_TARGET("avx512f") inline __m512d PolynomialAVX512(const double (&coefficients)[N], __m512d x)
+{
+  __m512d result = _mm512_set1_pd(coefficients[0]);
+  for(size_t i = 1; i < N; i++)
+  {
+    result = _mm512_add_pd(_mm512_mul_pd(result, x), _mm512_set1_pd(coefficients[i]));
+  }
+  return result;
+}
+
+ITKIP_TARGET("avx512f") inline __m512d ExpAVX512(__m512d x)
+{
+  const __m512d magic = _mm512_set1_pd(RoundingMagic);
+  const __m512d clamped = _mm512_max_pd(_mm512_min_pd(x, _mm512_set1_pd(ExpMax)), _mm512_set1_pd(ExpMin));
+  const __m512d t = _mm512_add_pd(_mm512_mul_pd(clamped, _mm512_set1_pd(Log2E)), magic);
+  const __m512d n = _mm512_sub_pd(t, magic);
+  __m512d r = _mm512_sub_pd(clamped, _mm512_mul_pd(n, _mm512_set1_pd(Ln2High)));
+  r = _mm512_sub_pd(r, _mm512_mul_pd(n, _mm512_set1_pd(Ln2Low)));
+  const __m512i exponent = _mm512_slli_epi64(_mm512_add_epi64(_mm512_castpd_si512(t), _mm512_set1_epi64(1023)), 52);
+  const __m512d result = _mm512_mul_pd(PolynomialAVX512(ExpCoefficients, r), _mm512_castsi512_pd(exponent));
+  return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), result, x);
+}
+
+ITKIP_TARGET("avx512f") inline __m512d LogAVX512(__m512d x)
+{
+  const __m512d one = _mm512_set1_pd(1.0);
+  const __m512i bits = _mm512_castpd_si512(x);
+  __m512d m = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL)), _mm512_castpd_si512(one)));
+  __m512d e = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_srli_epi64(bits, 52), _mm512_castpd_si512(_mm512_set1_pd(TwoPow52)))), _mm512_set1_pd(TwoPow52 + 1023.0));
+  const __mmask8 above = _mm512_cmp_pd_mask(m, _mm512_set1_pd(Sqrt2), _CMP_GE_OQ);
+  m = _mm512_mask_mul_pd(m, above, m, _mm512_set1_pd(0.5));
+  e = _mm512_mask_add_pd(e, above, e, one);
+  const __m512d s = _mm512_div_pd(_mm512_sub_pd(m, one), _mm512_add_pd(m, one));
+  const __m512d z = _mm512_mul_pd(s, s);
+  const __m512d twoS = _mm512_add_pd(s, s);
+  const __m512d logM = _mm512_add_pd(twoS, _mm512_mul_pd(twoS, _mm512_mul_pd(z, PolynomialAVX512(LogCoefficients, z))));
+  __m512d result = _mm512_add_pd(_mm512_mul_pd(e, _mm512_set1_pd(Ln2High)), _mm512_add_pd(_mm512_mul_pd(e, _mm512_set1_pd(Ln2Low)), logM));
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d infinity = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+  result = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, infinity, _CMP_EQ_OQ), result, infinity);
+  result = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, zero, _CMP_EQ_OQ), result, _mm512_sub_pd(zero, infinity));
+  result = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ), result, _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+  return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), result, x);
+}
+
+// |x| <= SinMax
+ITKIP_TARGET("avx512f") inline __m512d SinAVX512(__m512d x)
+{
+  const __m512d magic = _mm512_set1_pd(RoundingMagic);
+  const __m512d t = _mm512_add_pd(_mm512_mul_pd(x, _mm512_set1_pd(TwoOverPi)), magic);
+  const __m512d k = _mm512_sub_pd(t, magic);
+  __m512d r = _mm512_sub_pd(x, _mm512_mul_pd(k, _mm512_set1_pd(PiOver2Part1)));
+  r = _mm512_sub_pd(r, _mm512_mul_pd(k, _mm512_set1_pd(PiOver2Part2)));
+  r = _mm512_sub_pd(r, _mm512_mul_pd(k, _mm512_set1_pd(PiOver2Part3)));
+  const __m512d z = _mm512_mul_pd(r, r);
+  const __m512d sinR = _mm512_add_pd(r, _mm512_mul_pd(_mm512_mul_pd(r, z), PolynomialAVX512(SinCoefficients, z)));
+  const __m512d cosR = _mm512_add_pd(_mm512_set1_pd(1.0), _mm512_mul_pd(z, PolynomialAVX512(CosCoefficients, z)));
+  const __m512i quadrant = _mm512_castpd_si512(t);
+  const __mmask8 odd = _mm512_test_epi64_mask(quadrant, _mm512_set1_epi64(1));
+  const __m512i sign = _mm512_slli_epi64(_mm512_and_si512(quadrant, _mm512_set1_epi64(2)), 62);
+  return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_mask_blend_pd(odd, sinR, cosR)), sign));
+}
+
+ITKIP_TARGET("avx512f") inline __m512d EvaluateAVX512(UnaryMathOperation operation, __m512d x)
+{
+  switch(operation)
+  {
+  case UnaryMathOperation::Exp:
+    return ExpAVX512(x);
+  case UnaryMathOperation::ExpNegative:
+    return ExpAVX512(_mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x), _mm512_set1_epi64(std::numeric_limits<long long>::min()))));
+  case UnaryMathOperation::Log:
+    return LogAVX512(x);
+  default:
+    return SinAVX512(x);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Exp, ExpNegative, Log and Sin of floats, sixteen values at a time. Returns the number of
+// values processed.
+// -----------------------------------------------------------------------------
+ITKIP_TARGET("avx512f") size_t TranscendentalAVX512(UnaryMathOperation operation, const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 16;
+  const __m512 sinMax = _mm512_set1_ps(static_cast<float>(SinMax));
+  for(size_t i = 0; i < end; i += 16)
+  {
+    const __m512 values = _mm512_loadu_ps(input + i);
+    // Also true for NaN, which std::sin handles
+    if(operation == UnaryMathOperation::Sin && _mm512_cmp_ps_mask(_mm512_abs_ps(values), sinMax, _CMP_NLE_UQ) != 0)
+    {
+      ScalarKernel<float>(operation, input + i, output + i, 16);
+      continue;
+    }
+    const __m256 low = _mm512_cvtpd_ps(EvaluateAVX512(operation, _mm512_cvtps_pd(_mm256_loadu_ps(input + i))));
+    const __m256 high = _mm512_cvtpd_ps(EvaluateAVX512(operation, _mm512_cvtps_pd(_mm256_loadu_ps(input + i + 8))));
+    _mm256_storeu_ps(output + i, low);
+    _mm256_storeu_ps(output + i + 8, high);
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+// AVX-512 (foundation instructions only). Returns the number of values processed.
+// -----------------------------------------------------------------------------
+ITKIP_TARGET("avx512f") size_t KernelAVX512(UnaryMathOperation operation, const float* input, float* output, size_t count)
+{
+  const size_t end = count - count % 16;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    for(size_t i = 0; i < end; i += 16)
+    {
+      _mm512_storeu_ps(output + i, _mm512_abs_ps(_mm512_loadu_ps(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 16)
+    {
+      _mm512_storeu_ps(output + i, _mm512_sqrt_ps(_mm512_loadu_ps(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 16)
+    {
+      const __m512 value = _mm512_loadu_ps(input + i);
+      _mm512_storeu_ps(output + i, _mm512_mul_ps(value, value));
+    }
+    break;
+  default:
+    return TranscendentalAVX512(operation, input, output, count);
+  }
+  return end;
+}
+
+ITKIP_TARGET("avx512f") size_t KernelAVX512(UnaryMathOperation operation, const double* input, double* output, size_t count)
+{
+  const size_t end = count - count % 8;
+  switch(operation)
+  {
+  case UnaryMathOperation::Abs:
+  {
+    for(size_t i = 0; i < end; i += 8)
+    {
+      _mm512_storeu_pd(output + i, _mm512_abs_pd(_mm512_loadu_pd(input + i)));
+    }
+    break;
+  }
+  case UnaryMathOperation::Sqrt:
+    for(size_t i = 0; i < end; i += 8)
+    {
+      _mm512_storeu_pd(output + i, _mm512_sqrt_pd(_mm512_loadu_pd(input + i)));
+    }
+    break;
+  case UnaryMathOperation::Square:
+    for(size_t i = 0; i < end; i += 8)
+    {
+      const __m512d value = _mm512_loadu_pd(input + i);
+      _mm512_storeu_pd(output + i, _mm512_mul_pd(value, value));
+    }
+    break;
+  default:
+    return 0;
+  }
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMDInstructionSet DetectInstructionSet()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  if(!osxsave)
+  {
+    return SIMDInstructionSet::SSE2;
+  }
+  // The operating system must save the YMM (and ZMM) registers
+  const unsigned long long xcr0 = _xgetbv(0);
+  __cpuid(info, 0);
+  if(info[0] < 7)
+  {
+    return SIMDInstructionSet::SSE2;
+  }
+  __cpuidex(info, 7, 0);
+  if((info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6)
+  {
+    return SIMDInstructionSet::AVX512;
+  }
+  if((info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6)
+  {
+    return SIMDInstructionSet::AVX2;
+  }
+  return SIMDInstructionSet::SSE2;
+#else
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f"))
+  {
+    return SIMDInstructionSet::AVX512;
+  }
+  if(__builtin_cpu_supports("avx2"))
+  {
+    return SIMDInstructionSet::AVX2;
+  }
+  return SIMDInstructionSet::SSE2;
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void Apply(UnaryMathOperation operation, SIMDInstructionSet instructionSet, const T* input, T* output, size_t count)
+{
+  size_t done = 0;
+#if defined(ITKIP_SIMD_X86_64)
+  if(HasSIMDKernel(operation, input))
+  {
+    const SIMDInstructionSet supported = ITKDream3DHelper::GetSupportedSIMDInstructionSet();
+    if(instructionSet > supported)
+    {
+      instructionSet = supported;
+    }
+    switch(instructionSet)
+    {
+    case SIMDInstructionSet::AVX512:
+      done = KernelAVX512(operation, input, output, count);
+      break;
+    case SIMDInstructionSet::AVX2:
+      done = KernelAVX2(operation, input, output, count);
+      break;
+    case SIMDInstructionSet::SSE2:
+      done = KernelSSE2(operation, input, output, count);
+      break;
+    default:
+      break;
+    }
+  }
+#else
+  (void)instructionSet;
+#endif
+  // Remaining values, or the whole buffer without SIMD kernel
+  ScalarKernel<T>(operation, input + done, output + done, count - done);
+}
+} // end anonymous namespace
+
+namespace ITKDream3DHelper
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMDInstructionSet GetSupportedSIMDInstructionSet()
+{
+#if defined(ITKIP_SIMD_X86_64)
+  static const SIMDInstructionSet supported = DetectInstructionSet();
+  return supported;
+#else
+  return SIMDInstructionSet::None;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* GetSIMDInstructionSetName(SIMDInstructionSet instructionSet)
+{
+  switch(instructionSet)
+  {
+  case SIMDInstructionSet::SSE2:
+    return "sse2";
+  case SIMDInstructionSet::AVX2:
+    return "avx2";
+  case SIMDInstructionSet::AVX512:
+    return "avx512";
+  default:
+    return "none";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ApplyUnaryMath(UnaryMathOperation operation, SIMDInstructionSet instructionSet, const float* input, float* output, size_t count)
+{
+  Apply<float>(operation, instructionSet, input, output, count);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ApplyUnaryMath(UnaryMathOperation operation, SIMDInstructionSet instructionSet, const double* input, double* output, size_t count)
+{
+  Apply<double>(operation, instructionSet, input, output, count);
+}
+} // end of ITKDream3DHelper namespace
@@ -0,0 +1,60 @@
+#ifndef _ITKUnaryMathKernels_h
+#define _ITKUnaryMathKernels_h
+
+#include <cstddef>
+
+namespace ITKDream3DHelper
+{
+
+/**
+ * @brief Pixel-wise operations of the generated unary math filters that have a dedicated kernel.
+ */
+enum class UnaryMathOperation
+{
+  Abs,
+  Sqrt,
+  Square,
+  Exp,
+  ExpNegative,
+  Log,
+  Sin
+};
+
+/**
+ * @brief SIMD instruction sets the kernels are compiled for, from the least to the most capable.
+ */
+enum class SIMDInstructionSet
+{
+  None,
+  SSE2,
+  AVX2,
+  AVX512
+};
+
+/**
+ * @brief GetSupportedSIMDInstructionSet Returns the most capable instruction set that both the build
+ * and the processor support. Detected once.
+ */
+SIMDInstructionSet GetSupportedSIMDInstructionSet();
+
+/**
+ * @brief GetSIMDInstructionSetName Returns "none", "sse2", "avx2" or "avx512"
+ */
+const char* GetSIMDInstructionSetName(SIMDInstructionSet instructionSet);
+
+/**
+ * @brief ApplyUnaryMath Applies 'operation' to the 'count' contiguous values of 'input' and writes
+ * the results in 'output', which may be 'input'. 'instructionSet' is lowered to the supported one if
+ * needed.
+ *
+ * Abs, Sqrt and Square use explicit SIMD instructions and are exactly rounded, like the ITK functors.
+ * Exp, ExpNegative, Log and Sin of floats use SIMD approximations in double precision that are within
+ * 1 ULP of the ITK functors once rounded to float (identical on all the float values when checked).
+ * SSE2 only vectorizes Sin. Exp, ExpNegative, Log and Sin of doubles call the standard library like ITK.
+ */
+void ApplyUnaryMath(UnaryMathOperation operation, SIMDInstructionSet instructionSet, const float* input, float* output, size_t count);
+void ApplyUnaryMath(UnaryMathOperation operation, SIMDInstructionSet instructionSet, const double* input, double* output, size_t count);
+
+} // end of ITKDream3DHelper namespace
+
+#endif
@@ -33,6 +33,8 @@
 
 #include "ITKImageProcessingPlugin.h"
 
+#include <algorithm>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -42,6 +44,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkChunkedVolumeImageIOFactory.h"
 
 #include "itkSCIFIOImageIOFactory.h"
 #include "itksys/SystemTools.hxx"
@@ -53,6 +56,7 @@
 #include <itkJPEGImageIOFactory.h>
 #include <itkJPEGImageIOFactory.h>
 #include <itkMRCImageIOFactory.h>
+#include <itkMultiThreader.h>
 #include <itkMetaImageIOFactory.h>
 #include <itkNiftiImageIOFactory.h>
 #include <itkNrrdImageIOFactory.h>
@@ -83,6 +87,10 @@ ITKImageProcessingPlugin::ITKImageProcessingPlugin()
     m_Filters(QList<QString>())
 , // Initialize ITKImageProcessing's List of Dependencies Here
     m_DidLoad(false)
+, m_MaximumNumberOfThreads(0)
+, m_UseThreadPool(false)
+, m_HasUseThreadPool(false)
+, m_TraceFile("")
 {
   ITKImageProcessingPlugin::setSCIFIOEnvironmentVariables();
   itk::JPEGImageIOFactory::RegisterOneFactory();
@@ -100,6 +108,7 @@ ITKImageProcessingPlugin::ITKImageProcessingPlugin()
   itk::GE4ImageIOFactory::RegisterOneFactory();
   itk::GE5ImageIOFactory::RegisterOneFactory();
   itk::MRCImageIOFactory::RegisterOneFactory();
+  itk::ChunkedVolumeImageIOFactory::RegisterOneFactory();
   itk::SCIFIOImageIOFactory::RegisterOneFactory();
 }
 
@@ -360,6 +369,13 @@ void ITKImageProcessingPlugin::setLocation(QString filePath)
 // -----------------------------------------------------------------------------
 void ITKImageProcessingPlugin::writeSettings(QSettings& prefs)
 {
+  prefs.setValue(ITKImageProcessingConstants::Settings::MaximumNumberOfThreads, m_MaximumNumberOfThreads);
+  // An unset preference keeps the ITK_USE_THREADPOOL environment variable in effect
+  if(m_HasUseThreadPool)
+  {
+    prefs.setValue(ITKImageProcessingConstants::Settings::UseThreadPool, m_UseThreadPool);
+  }
+  prefs.setValue(ITKImageProcessingConstants::Settings::TraceFile, m_TraceFile);
 }
 
 // -----------------------------------------------------------------------------
@@ -367,6 +383,46 @@ void ITKImageProcessingPlugin::writeSettings(QSettings& prefs)
 // -----------------------------------------------------------------------------
 void ITKImageProcessingPlugin::readSettings(QSettings& prefs)
 {
+  if(prefs.contains(ITKImageProcessingConstants::Settings::MaximumNumberOfThreads))
+  {
+    m_MaximumNumberOfThreads = prefs.value(ITKImageProcessingConstants::Settings::MaximumNumberOfThreads).toInt();
+    ITKImageProcessingPlugin::applyMaximumNumberOfThreads(m_MaximumNumberOfThreads);
+  }
+  m_HasUseThreadPool = prefs.contains(ITKImageProcessingConstants::Settings::UseThreadPool);
+  if(m_HasUseThreadPool)
+  {
+    m_UseThreadPool = prefs.value(ITKImageProcessingConstants::Settings::UseThreadPool).toBool();
+    ITKImageProcessingPlugin::applyUseThreadPool(m_UseThreadPool);
+  }
+  m_TraceFile = prefs.value(ITKImageProcessingConstants::Settings::TraceFile, m_TraceFile).toString();
+  // The environment variable takes precedence over the settings
+  std::string traceVariable = ITKImageProcessingConstants::TraceFileEnvironmentVariable.toStdString();
+  if(!m_TraceFile.isEmpty() && !itksys::SystemTools::HasEnv(traceVariable))
+  {
+    itksys::SystemTools::PutEnv(traceVariable + "=" + m_TraceFile.toStdString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingPlugin::applyMaximumNumberOfThreads(int maximumNumberOfThreads)
+{
+  if(maximumNumberOfThreads > 0)
+  {
+    itk::ThreadIdType numberOfThreads = static_cast<itk::ThreadIdType>(maximumNumberOfThreads);
+    itk::MultiThreader::SetGlobalMaximumNumberOfThreads(numberOfThreads);
+    itk::MultiThreader::SetGlobalDefaultNumberOfThreads(std::min(numberOfThreads, itk::MultiThreader::GetGlobalDefaultNumberOfThreads()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingPlugin::applyUseThreadPool(bool useThreadPool)
+{
+  // Concurrent pipelines then share the same bounded set of threads.
+  itk::MultiThreader::SetGlobalDefaultUseThreadPool(useThreadPool);
 }
 
 #include "ITKImageProcessingFilters/RegisterKnownFilters.cpp"
@@ -193,6 +193,21 @@ public:
    */
   virtual void readSettings(QSettings& prefs);
 
+  /**
+   * @brief applyMaximumNumberOfThreads Sets the maximum number of threads any ITK filter may use
+   * (0 keeps ITK's default).
+   * @param maximumNumberOfThreads Maximum number of threads
+   */
+  static void applyMaximumNumberOfThreads(int maximumNumberOfThreads);
+
+  /**
+   * @brief applyUseThreadPool Sets whether all the ITK filters share a single pool of threads
+   * instead of spawning their own. Only called when the preference is set: ITK's default otherwise
+   * comes from the ITK_USE_THREADPOOL environment variable.
+   * @param useThreadPool Use the shared ITK thread pool
+   */
+  static void applyUseThreadPool(bool useThreadPool);
+
 private:
   QString m_Version;
   QString m_CompatibilityVersion;
@@ -203,6 +218,10 @@ private:
   QString m_Copyright;
   QList<QString> m_Filters;
   bool m_DidLoad;
+  int m_MaximumNumberOfThreads;
+  bool m_UseThreadPool;
+  bool m_HasUseThreadPool;
+  QString m_TraceFile;
 
   ITKImageProcessingPlugin(const ITKImageProcessingPlugin&) = delete; // Copy Constructor Not Implemented
   void operator=(const ITKImageProcessingPlugin&);           // Operator '=' Not Implemented
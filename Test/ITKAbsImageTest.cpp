@@ -50,6 +50,47 @@ public:
     return 0;
   }
 
+  int TestITKAbsImagefloatNewArrayTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKAbsImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(true);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(QString("Output"));
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // The filtered image is written in the created array...
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", "Output");
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_AbsImageFilter_float.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, output_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    // ...and the input array is left untouched.
+    DataArrayPath original_path("OContainer", "OAttributeMatrixName", "OAttributeArrayName");
+    this->ReadImage(input_filename, containerArray, original_path);
+    res = this->CompareImages(containerArray, input_path, original_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   int TestITKAbsImageshortTest()
   {
     QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
@@ -82,6 +123,45 @@ public:
     return 0;
   }
 
+  int TestITKAbsImageshortInPlaceTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    IDataArray::Pointer inputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(inputArray.get());
+    void* inputBuffer = inputArray->getVoidPointer(0);
+    QString filtName = "ITKAbsImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // The filter ran in place: the input array and its buffer are kept...
+    IDataArray::Pointer outputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE_EQUAL(outputArray.get(), inputArray.get());
+    DREAM3D_REQUIRE_EQUAL(outputArray->getVoidPointer(0), inputBuffer);
+    // ...and hold the filtered image.
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_AbsImageFilter_short.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -92,7 +172,9 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKAbsImage"));
 
     DREAM3D_REGISTER_TEST(TestITKAbsImagefloatTest());
+    DREAM3D_REGISTER_TEST(TestITKAbsImagefloatNewArrayTest());
     DREAM3D_REGISTER_TEST(TestITKAbsImageshortTest());
+    DREAM3D_REGISTER_TEST(TestITKAbsImageshortInPlaceTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -88,6 +88,29 @@ public:
     return 0;
   }
 
+  int TestITKConnectedComponentImageslicesTest()
+  {
+    // Labels are assigned over the whole image: the slices cannot be processed independently
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKConnectedComponentImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SliceBySlice", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -14);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -99,6 +122,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestITKConnectedComponentImagedefaultTest());
     DREAM3D_REGISTER_TEST(TestITKConnectedComponentImagefullyconnectedTest());
+    DREAM3D_REGISTER_TEST(TestITKConnectedComponentImageslicesTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -97,6 +97,81 @@ public:
     return 0;
   }
 
+  int TestITKCurvatureFlowImageinPlaceTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    IDataArray::Pointer inputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    QString filtName = "ITKCurvatureFlowImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // A float input is not copied by the casts: the filter runs in place on the selected array
+    IDataArray::Pointer outputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE(outputArray.get() == inputArray.get());
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_CurvatureFlowImageFilter_defaults.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.0001);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKCurvatureFlowImagekeepInputTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKCurvatureFlowImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(true);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(QString("Output"));
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // The float input is kept: the filter must not have run in place on it
+    DataArrayPath reference_path("ReferenceContainer", "ReferenceAttributeMatrixName", "ReferenceAttributeArrayName");
+    this->ReadImage(input_filename, containerArray, reference_path);
+    int res = this->CompareImages(containerArray, input_path, reference_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    DataArrayPath output_path(input_path.getDataContainerName(), input_path.getAttributeMatrixName(), "Output");
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_CurvatureFlowImageFilter_defaults.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    res = this->CompareImages(containerArray, output_path, baseline_path, 0.0001);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -108,6 +183,8 @@ public:
 
     DREAM3D_REGISTER_TEST(TestITKCurvatureFlowImagedefaultsTest());
     DREAM3D_REGISTER_TEST(TestITKCurvatureFlowImagelongerTest());
+    DREAM3D_REGISTER_TEST(TestITKCurvatureFlowImageinPlaceTest());
+    DREAM3D_REGISTER_TEST(TestITKCurvatureFlowImagekeepInputTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
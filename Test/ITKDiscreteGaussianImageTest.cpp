@@ -128,6 +128,55 @@ public:
     return 0;
   }
 
+  int TestITKDiscreteGaussianImagebigGstreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/WhiteDots.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKDiscreteGaussianImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    {
+      double d3d_var;
+      d3d_var = 100.0;
+      var.setValue(d3d_var);
+      propWasSet = filter->setProperty("Variance", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    }
+    {
+      double d3d_var;
+      d3d_var = 64;
+      var.setValue(d3d_var);
+      propWasSet = filter->setProperty("MaximumKernelWidth", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    }
+    // Each piece needs input pixels far outside of it: the requested region is enlarged by the kernel radius
+    var.setValue(8);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    WriteImage("ITKDiscreteGaussianImagebigGstreamed.nrrd", containerArray, input_path);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    // Same hash as the "bigG" test
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("f2f002ec76313284a4cff24c3e5eb577"));
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -140,6 +189,7 @@ public:
     DREAM3D_REGISTER_TEST(TestITKDiscreteGaussianImagefloatTest());
     DREAM3D_REGISTER_TEST(TestITKDiscreteGaussianImageshortTest());
     DREAM3D_REGISTER_TEST(TestITKDiscreteGaussianImagebigGTest());
+    DREAM3D_REGISTER_TEST(TestITKDiscreteGaussianImagebigGstreamedTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
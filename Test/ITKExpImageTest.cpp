@@ -50,6 +50,15 @@ public:
     return 0;
   }
 
+  int TestITKExpImageSIMDTest()
+  {
+    // The SIMD kernels of float images are within 1 ULP of the ITK filter
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    int res = this->CompareUnaryMathKernelWithITK("ITKExpImage", input_filename, 1);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -60,6 +69,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKExpImage"));
 
     DREAM3D_REGISTER_TEST(TestITKExpImagedefaultsTest());
+    DREAM3D_REGISTER_TEST(TestITKExpImageSIMDTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -35,6 +35,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -51,6 +52,9 @@
 
 #include <itkImageFileWriter.h>
 #include <itkImageIOBase.h>
+#include <itkRGBPixel.h>
+
+#include <cstring>
 
 class ITKImageProcessingImportImageStackTest
 {
@@ -300,6 +304,174 @@ public:
     return EXIT_SUCCESS;
   }
 
+  IDataArray::Pointer ImportStack(const QString& containerName, int numberOfThreads)
+  {
+    IntVec3_t regionStart = {0, 0, 0};
+    IntVec3_t regionSize = {0, 0, 0};
+    IntVec3_t stride = {1, 1, 1};
+    return ImportStack(containerName, numberOfThreads, regionStart, regionSize, stride);
+  }
+
+  IDataArray::Pointer ImportStack(const QString& containerName, int numberOfThreads, IntVec3_t regionStart, IntVec3_t regionSize, IntVec3_t stride)
+  {
+    AbstractFilter::Pointer reader = GetFilterByName("ITKImportImageStack");
+    if(!reader)
+    {
+      return IDataArray::NullPointer();
+    }
+    reader->setProperty("DataContainerName", containerName);
+    reader->setProperty("NumberOfThreads", numberOfThreads);
+    QVariant regionVar;
+    regionVar.setValue(regionStart);
+    reader->setProperty("RegionStart", regionVar);
+    regionVar.setValue(regionSize);
+    reader->setProperty("RegionSize", regionVar);
+    regionVar.setValue(stride);
+    reader->setProperty("Stride", regionVar);
+    FileListInfo_t fileListInfo;
+    fileListInfo.InputPath = UnitTest::ITKImageProcessingImportImageStackTest::StackInputTestDir;
+    fileListInfo.StartIndex = 75;
+    fileListInfo.EndIndex = 77;
+    fileListInfo.FileExtension = "dcm";
+    fileListInfo.FilePrefix = "Image";
+    fileListInfo.FileSuffix = "";
+    fileListInfo.PaddingDigits = 4;
+    QVariant var;
+    var.setValue(fileListInfo);
+    reader->setProperty("InputFileListInfo", var);
+    reader->execute();
+    if(reader->getErrorCondition() < 0)
+    {
+      return IDataArray::NullPointer();
+    }
+    DataArrayPath path(containerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ImageData);
+    return reader->getDataContainerArray()->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+  }
+
+  int TestMultithreadedImport()
+  {
+    IDataArray::Pointer sequential = ImportStack("TestSequentialImport", 1);
+    DREAM3D_REQUIRE_NE(sequential.get(), 0);
+    IDataArray::Pointer parallel = ImportStack("TestParallelImport", 3);
+    DREAM3D_REQUIRE_NE(parallel.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(sequential->getTypeAsString(), parallel->getTypeAsString());
+    DREAM3D_REQUIRE_EQUAL(sequential->getSize(), parallel->getSize());
+    const size_t numberOfBytes = sequential->getSize() * sequential->getTypeSize();
+    DREAM3D_REQUIRE_EQUAL(memcmp(sequential->getVoidPointer(0), parallel->getVoidPointer(0), numberOfBytes), 0);
+    return EXIT_SUCCESS;
+  }
+
+  int TestStackRegion()
+  {
+    IDataArray::Pointer full = ImportStack("TestFullStack", 0);
+    DREAM3D_REQUIRE_NE(full.get(), 0);
+    // Slices 76 and 77, X from 10 to 109 every 3 pixels, Y from 20 to 69 every 2 pixels
+    IntVec3_t regionStart = {10, 20, 1};
+    IntVec3_t regionSize = {100, 50, 0};
+    IntVec3_t stride = {3, 2, 1};
+    IDataArray::Pointer region = ImportStack("TestStackRegion", 2, regionStart, regionSize, stride);
+    DREAM3D_REQUIRE_NE(region.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(full->getTypeAsString(), region->getTypeAsString());
+    const size_t fullDims[3] = {256, 256, 3};
+    const size_t regionDims[3] = {34, 25, 2};
+    DREAM3D_REQUIRE_EQUAL(region->getNumberOfTuples(), regionDims[0] * regionDims[1] * regionDims[2]);
+    const size_t typeSize = full->getTypeSize();
+    const char* fullData = static_cast<const char*>(full->getVoidPointer(0));
+    const char* regionData = static_cast<const char*>(region->getVoidPointer(0));
+    for(size_t z = 0, i = 0; z < regionDims[2]; z++)
+    {
+      for(size_t y = 0; y < regionDims[1]; y++)
+      {
+        for(size_t x = 0; x < regionDims[0]; x++, i++)
+        {
+          const size_t fullIndex = ((regionStart.z + z * stride.z) * fullDims[1] + regionStart.y + y * stride.y) * fullDims[0] + regionStart.x + x * stride.x;
+          DREAM3D_REQUIRE_EQUAL(memcmp(fullData + fullIndex * typeSize, regionData + i * typeSize, typeSize), 0);
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  template <typename TComponent> void WriteRGBSlice(const QString& fileName, unsigned int z)
+  {
+    typedef itk::RGBPixel<TComponent> RGBPixelType;
+    typedef itk::Image<RGBPixelType, 2> RGBSliceType;
+    typename RGBSliceType::SizeType size;
+    size[0] = 5;
+    size[1] = 4;
+    typename RGBSliceType::Pointer slice = RGBSliceType::New();
+    slice->SetRegions(size);
+    slice->Allocate();
+    RGBPixelType value;
+    value[0] = static_cast<TComponent>(10 + z);
+    value[1] = static_cast<TComponent>(20 + z);
+    value[2] = static_cast<TComponent>(30 + z);
+    slice->FillBuffer(value);
+    typedef itk::ImageFileWriter<RGBSliceType> WriterType;
+    typename WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(fileName.toStdString());
+    writer->SetInput(slice);
+    writer->Update();
+  }
+
+  int TestRGBStack()
+  {
+    const unsigned int numberOfSlices = 3;
+    const size_t size[2] = {5, 4};
+    QStringList fileNames;
+    for(unsigned int z = 0; z < numberOfSlices; z++)
+    {
+      QString fileName = QString("%1%2%3.png").arg(UnitTest::ITKImageProcessingImportImageStackTest::RGBStackTestDir).arg(UnitTest::ITKImageProcessingImportImageStackTest::RGBStackTestFilePrefix).arg(z);
+      // The last slice is saved with 16 bit components: they are converted to the 8 bit components of the first slice
+      if(z == numberOfSlices - 1)
+      {
+        WriteRGBSlice<unsigned short>(fileName, z);
+      }
+      else
+      {
+        WriteRGBSlice<unsigned char>(fileName, z);
+      }
+      fileNames << fileName;
+    }
+
+    AbstractFilter::Pointer reader = GetFilterByName("ITKImportImageStack");
+    DREAM3D_REQUIRE_NE(reader.get(), 0);
+    const QString containerName = "TestRGBStack";
+    reader->setProperty("DataContainerName", containerName);
+    FileListInfo_t fileListInfo;
+    fileListInfo.InputPath = UnitTest::ITKImageProcessingImportImageStackTest::RGBStackTestDir;
+    fileListInfo.StartIndex = 0;
+    fileListInfo.EndIndex = numberOfSlices - 1;
+    fileListInfo.FileExtension = "png";
+    fileListInfo.FilePrefix = UnitTest::ITKImageProcessingImportImageStackTest::RGBStackTestFilePrefix;
+    fileListInfo.FileSuffix = "";
+    fileListInfo.PaddingDigits = 0;
+    QVariant var;
+    var.setValue(fileListInfo);
+    reader->setProperty("InputFileListInfo", var);
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+
+    DataArrayPath path(containerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ImageData);
+    IDataArray::Pointer array = reader->getDataContainerArray()->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+    UInt8ArrayType::Pointer imageData = std::dynamic_pointer_cast<UInt8ArrayType>(array);
+    DREAM3D_REQUIRE_NE(imageData.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(imageData->getNumberOfComponents(), 3);
+    DREAM3D_REQUIRE_EQUAL(imageData->getNumberOfTuples(), size[0] * size[1] * numberOfSlices);
+    for(unsigned int z = 0; z < numberOfSlices; z++)
+    {
+      const size_t tuple = z * size[0] * size[1] + 3;
+      DREAM3D_REQUIRE_EQUAL(imageData->getComponent(tuple, 0), 10 + z);
+      DREAM3D_REQUIRE_EQUAL(imageData->getComponent(tuple, 1), 20 + z);
+      DREAM3D_REQUIRE_EQUAL(imageData->getComponent(tuple, 2), 30 + z);
+    }
+    foreach(QString fileName, fileNames)
+    {
+      QFile::remove(fileName);
+    }
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -313,6 +485,9 @@ public:
     DREAM3D_REGISTER_TEST(TestNoFiles());
     DREAM3D_REGISTER_TEST(TestFileDoesNotExist());
     DREAM3D_REGISTER_TEST(TestCompareImage());
+    DREAM3D_REGISTER_TEST(TestMultithreadedImport());
+    DREAM3D_REGISTER_TEST(TestStackRegion());
+    DREAM3D_REGISTER_TEST(TestRGBStack());
   }
 
 private:
@@ -35,6 +35,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -45,6 +46,7 @@
 #include "UnitTestSupport.hpp"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkReadRegion.h"
 
 #include "ITKImageProcessingTestFileLocations.h"
 
@@ -58,6 +60,10 @@
 #include <itkSCIFIOImageIO.h>
 #include <itkTIFFImageIO.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 class ITKImageProcessingReaderTest
 {
 
@@ -84,6 +90,7 @@ public:
     QFile::remove(UnitTest::ITKImageProcessingReaderTest::TIFFIOInputTestFile);
     QFile::remove(UnitTest::ITKImageProcessingReaderTest::PNGIOInputTestFile);
     QFile::remove(UnitTest::ITKImageProcessingReaderTest::SCIFIOInputTestFile);
+    QFile::remove(UnitTest::ITKImageProcessingReaderTest::ChunkedIOInputTestFile);
 #endif
   }
 
@@ -342,6 +349,251 @@ public:
     return EXIT_SUCCESS;
   }
 
+  int TestStreamedReadRegion(const QString& file)
+  {
+    // Reads a box of the uncompressed MetaImage file written by TestReadRegion: only the box must be
+    // decoded, not the whole image.
+    itk::MetaImageIO::Pointer io = itk::MetaImageIO::New();
+    io->SetFileName(file.toStdString().c_str());
+    io->ReadImageInformation();
+    const size_t regionStart[3] = {3, 4, 5};
+    const size_t regionSize[3] = {10, 6, 7};
+    ITKDream3DHelper::ReadRegion region;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      region.start[i] = regionStart[i];
+      region.size[i] = regionSize[i];
+      region.stride[i] = 1;
+    }
+    const size_t numberOfPixels = regionSize[0] * regionSize[1] * regionSize[2];
+    std::vector<DefaultPixelType> buffer;
+    std::vector<DefaultPixelType> pixels(numberOfPixels);
+    ITKDream3DHelper::ReadRegionFromIO<DefaultPixelType>(io.GetPointer(), region, 1, buffer, pixels.data());
+    DREAM3D_REQUIRE_EQUAL(io->GetIORegion().GetNumberOfPixels(), numberOfPixels);
+    DREAM3D_REQUIRE(buffer.empty());
+    for(size_t z = 0, i = 0; z < regionSize[2]; z++)
+    {
+      for(size_t y = 0; y < regionSize[1]; y++)
+      {
+        for(size_t x = 0; x < regionSize[0]; x++, i++)
+        {
+          const DefaultPixelType expected = static_cast<DefaultPixelType>((x + regionStart[0]) + 100 * (y + regionStart[1]) + 10000 * (z + regionStart[2]));
+          DREAM3D_REQUIRE_EQUAL(pixels[i], expected);
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  int TestReadRegion(const QString& file, itk::ImageIOBase* io)
+  {
+    // Each pixel holds its index so that the pixels read can be located in the file
+    typedef itk::Dream3DImage<DefaultPixelType, 3> ImageType;
+    ImageType::PointType origin;
+    ImageType::SizeType size;
+    ImageType::SpacingType spacing;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      origin[i] = -1.3 + float(i);
+      size[i] = 20 + i * 3;
+      spacing[i] = 10.3 + float(i) * .2;
+    }
+    ImageType::Pointer image = CreateITKImageForTests<ImageType>(origin, size, spacing, 0);
+    DefaultPixelType* pixels = image->GetBufferPointer();
+    for(size_t z = 0, i = 0; z < size[2]; z++)
+    {
+      for(size_t y = 0; y < size[1]; y++)
+      {
+        for(size_t x = 0; x < size[0]; x++, i++)
+        {
+          pixels[i] = static_cast<DefaultPixelType>(x + 100 * y + 10000 * z);
+        }
+      }
+    }
+    typedef itk::ImageFileWriter<ImageType> WriterType;
+    WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(file.toStdString());
+    writer->SetInput(image);
+    writer->SetImageIO(io);
+    writer->Update();
+
+    AbstractFilter::Pointer reader = GetFilterByName("ITKImageReader");
+    DREAM3D_REQUIRE_NE(0, reader.get());
+    const QString containerName = "TestContainer";
+    reader->setDataContainerArray(DataContainerArray::New());
+    bool propertySet = reader->setProperty("DataContainerName", containerName);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    propertySet = reader->setProperty("FileName", file);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    // X: 10 pixels from 3 every 2, Y: from 4 to the end every 3, Z: 7 slices from 5 every 2
+    const int start[3] = {3, 4, 5};
+    const int regionSize[3] = {10, 0, 7};
+    const int stride[3] = {2, 3, 2};
+    const size_t expectedDims[3] = {5, 7, 4};
+    IntVec3_t vec;
+    QVariant var;
+    vec.x = start[0];
+    vec.y = start[1];
+    vec.z = start[2];
+    var.setValue(vec);
+    propertySet = reader->setProperty("RegionStart", var);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    vec.x = regionSize[0];
+    vec.y = regionSize[1];
+    vec.z = regionSize[2];
+    var.setValue(vec);
+    propertySet = reader->setProperty("RegionSize", var);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    vec.x = stride[0];
+    vec.y = stride[1];
+    vec.z = stride[2];
+    var.setValue(vec);
+    propertySet = reader->setProperty("Stride", var);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+
+    DataContainer::Pointer container = reader->getDataContainerArray()->getDataContainer(containerName);
+    DREAM3D_REQUIRE_NE(container.get(), 0);
+    ImageGeom::Pointer imageGeometry = std::dynamic_pointer_cast<ImageGeom>(container->getGeometry());
+    DREAM3D_REQUIRE_NE(imageGeometry.get(), 0);
+    float tol = 1e-4;
+    float resolution[3];
+    imageGeometry->getResolution(resolution[0], resolution[1], resolution[2]);
+    float geometryOrigin[3];
+    imageGeometry->getOrigin(geometryOrigin[0], geometryOrigin[1], geometryOrigin[2]);
+    size_t dimensions[3];
+    imageGeometry->getDimensions(dimensions[0], dimensions[1], dimensions[2]);
+    for(int i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(dimensions[i], expectedDims[i]);
+      float expectedResolution = spacing[i] * stride[i];
+      DREAM3D_COMPARE_FLOATS(&resolution[i], &expectedResolution, tol);
+      float expectedOrigin = origin[i] + spacing[i] * start[i];
+      DREAM3D_COMPARE_FLOATS(&geometryOrigin[i], &expectedOrigin, tol);
+    }
+
+    AttributeMatrix::Pointer attributeMatrix = container->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    DREAM3D_REQUIRE_NE(attributeMatrix.get(), 0);
+    IDataArray::Pointer dataArray = attributeMatrix->getAttributeArray(SIMPL::CellData::ImageData);
+    DREAM3D_REQUIRE_NE(dataArray.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(dataArray->getNumberOfTuples(), expectedDims[0] * expectedDims[1] * expectedDims[2]);
+    const DefaultPixelType* values = static_cast<DefaultPixelType*>(dataArray->getVoidPointer(0));
+    for(size_t z = 0, i = 0; z < expectedDims[2]; z++)
+    {
+      for(size_t y = 0; y < expectedDims[1]; y++)
+      {
+        for(size_t x = 0; x < expectedDims[0]; x++, i++)
+        {
+          const size_t fileIndex[3] = {start[0] + x * stride[0], start[1] + y * stride[1], start[2] + z * stride[2]};
+          DREAM3D_REQUIRE_EQUAL(values[i], static_cast<DefaultPixelType>(fileIndex[0] + 100 * fileIndex[1] + 10000 * fileIndex[2]));
+        }
+      }
+    }
+
+    // A region that does not fit in the image is rejected
+    vec.x = 0;
+    vec.y = 0;
+    vec.z = static_cast<int>(size[2]) + 1;
+    var.setValue(vec);
+    reader->setProperty("RegionSize", var);
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), ==, -6);
+    return EXIT_SUCCESS;
+  }
+
+  int ReadMapped(const QString& file, UInt8ArrayType::Pointer& imageData)
+  {
+    AbstractFilter::Pointer reader = GetFilterByName("ITKImageReader");
+    DREAM3D_REQUIRE_NE(0, reader.get());
+    const QString containerName = "TestContainer";
+    reader->setDataContainerArray(DataContainerArray::New());
+    bool propertySet = reader->setProperty("DataContainerName", containerName);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    propertySet = reader->setProperty("FileName", file);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    propertySet = reader->setProperty("MemoryMap", true);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+    DataArrayPath path(containerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ImageData);
+    IDataArray::Pointer array = reader->getDataContainerArray()->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+    imageData = std::dynamic_pointer_cast<UInt8ArrayType>(array);
+    DREAM3D_REQUIRE_NE(imageData.get(), 0);
+    return reader->getWarningCondition();
+  }
+
+  int TestCorruptedChunkedVolume(const QString& file)
+  {
+    // Replaces the size of the first block of the chunked volume written by TestReadRegion, in the
+    // index that follows the header, by a huge value: the file must be rejected before decoding.
+    QFile chunkedFile(file);
+    DREAM3D_REQUIRE(chunkedFile.open(QIODevice::ReadWrite));
+    QByteArray content = chunkedFile.readAll();
+    const QByteArray headerEnd = "HeaderEnd\n";
+    const int headerEndPosition = content.indexOf(headerEnd);
+    DREAM3D_REQUIRED(headerEndPosition, >, 0);
+    const int indexPosition = headerEndPosition + headerEnd.size();
+    DREAM3D_REQUIRE(chunkedFile.seek(indexPosition + 8));
+    const QByteArray hugeSize(8, char(0x7F));
+    DREAM3D_REQUIRE_EQUAL(chunkedFile.write(hugeSize), 8);
+    chunkedFile.close();
+
+    AbstractFilter::Pointer reader = GetFilterByName("ITKImageReader");
+    DREAM3D_REQUIRE_NE(0, reader.get());
+    const QString containerName = "TestContainer";
+    reader->setDataContainerArray(DataContainerArray::New());
+    bool propertySet = reader->setProperty("DataContainerName", containerName);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    propertySet = reader->setProperty("FileName", file);
+    DREAM3D_REQUIRE_EQUAL(propertySet, true);
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), <, 0);
+    return EXIT_SUCCESS;
+  }
+
+  int TestMemoryMap(const QString& file, itk::ImageIOBase* io, bool compress, bool expectMapped)
+  {
+    typedef itk::Dream3DImage<unsigned char, 3> ImageType;
+    ImageType::PointType origin;
+    ImageType::SizeType size;
+    ImageType::SpacingType spacing;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+      origin[i] = 0.0;
+      size[i] = 17 + i * 3;
+      spacing[i] = 1.0;
+    }
+    ImageType::Pointer image = CreateITKImageForTests<ImageType>(origin, size, spacing, 0);
+    unsigned char* pixels = image->GetBufferPointer();
+    const size_t numberOfPixels = image->GetLargestPossibleRegion().GetNumberOfPixels();
+    for(size_t i = 0; i < numberOfPixels; i++)
+    {
+      pixels[i] = static_cast<unsigned char>((i * 7) % 251);
+    }
+    typedef itk::ImageFileWriter<ImageType> WriterType;
+    WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(file.toStdString());
+    writer->SetInput(image);
+    writer->SetImageIO(io);
+    writer->SetUseCompression(compress);
+    writer->Update();
+
+    UInt8ArrayType::Pointer imageData;
+    int warning = ReadMapped(file, imageData);
+    DREAM3D_REQUIRE_EQUAL(warning, (expectMapped ? 0 : -8));
+    DREAM3D_REQUIRE_EQUAL(imageData->getNumberOfTuples(), numberOfPixels);
+    DREAM3D_REQUIRE_EQUAL(memcmp(imageData->getPointer(0), pixels, numberOfPixels), 0);
+
+    // The mapping is private: modifying the array does not modify the file
+    std::fill(imageData->getPointer(0), imageData->getPointer(0) + numberOfPixels, 0);
+    imageData = UInt8ArrayType::NullPointer();
+    ReadMapped(file, imageData);
+    DREAM3D_REQUIRE_EQUAL(memcmp(imageData->getPointer(0), pixels, numberOfPixels), 0);
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -404,6 +656,27 @@ public:
     typedef itk::Vector<DefaultPixelType, 3> RGBAPixelType;
     itk::Dream3DImage<RGBAPixelType, 3>::Pointer rgbaImage = WriteNRRDIOTestFile<RGBAPixelType>();
     DREAM3D_REGISTER_TEST((TestCompareImage<RGBAPixelType, 3>(UnitTest::ITKImageProcessingReaderTest::NRRDIOInputTestFile, rgbaImage)))
+
+    // Sub-volumes: uncompressed MetaImage streams the region, NRRD reads the whole file
+    itk::MetaImageIO::Pointer metaIO = itk::MetaImageIO::New();
+    DREAM3D_REGISTER_TEST(TestReadRegion(UnitTest::ITKImageProcessingReaderTest::METAIOInputTestFile, metaIO.GetPointer()))
+    DREAM3D_REGISTER_TEST(TestStreamedReadRegion(UnitTest::ITKImageProcessingReaderTest::METAIOInputTestFile))
+    itk::NrrdImageIO::Pointer nrrdIO = itk::NrrdImageIO::New();
+    DREAM3D_REGISTER_TEST(TestReadRegion(UnitTest::ITKImageProcessingReaderTest::NRRDIOInputTestFile, nrrdIO.GetPointer()))
+    // Chunked volumes only decode the blocks of the region. The ImageIO comes from the factory
+    // registered by the plugin.
+    DREAM3D_REGISTER_TEST(TestReadRegion(UnitTest::ITKImageProcessingReaderTest::ChunkedIOInputTestFile, nullptr))
+    DREAM3D_REGISTER_TEST(TestCorruptedChunkedVolume(UnitTest::ITKImageProcessingReaderTest::ChunkedIOInputTestFile))
+
+    // Memory mapping: uncompressed files are mapped, compressed ones are read with a warning
+    metaIO = itk::MetaImageIO::New();
+    DREAM3D_REGISTER_TEST(TestMemoryMap(UnitTest::ITKImageProcessingReaderTest::METAIOInputTestFile, metaIO.GetPointer(), false, true))
+    nrrdIO = itk::NrrdImageIO::New();
+    DREAM3D_REGISTER_TEST(TestMemoryMap(UnitTest::ITKImageProcessingReaderTest::NRRDIOInputTestFile, nrrdIO.GetPointer(), false, true))
+    itk::MRCImageIO::Pointer mrcIO = itk::MRCImageIO::New();
+    DREAM3D_REGISTER_TEST(TestMemoryMap(UnitTest::ITKImageProcessingReaderTest::MRCIOInputTestFile, mrcIO.GetPointer(), false, true))
+    metaIO = itk::MetaImageIO::New();
+    DREAM3D_REGISTER_TEST(TestMemoryMap(UnitTest::ITKImageProcessingReaderTest::METAIOInputTestFile, metaIO.GetPointer(), true, false))
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
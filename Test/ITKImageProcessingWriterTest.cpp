@@ -49,6 +49,8 @@
 #include "ITKImageProcessingTestFileLocations.h"
 
 #include <QFileInfo>
+#include <itkImage.h>
+#include <itkImageFileReader.h>
 #include <itkNumericSeriesFileNames.h>
 
 class ITKImageProcessingWriterTest
@@ -402,6 +404,205 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteImageSeriesThreaded()
+  {
+    QString filename = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + "Threaded.png";
+    DataArrayPath path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = CreateTestData<uint8_t, 3>(path);
+    // Each slice gets its own values so that a slice written to the wrong file is detected
+    const size_t dims[3] = {90, 93, 96};
+    IDataArray::Pointer array = containerArray->getDataContainer(path.getDataContainerName())->getAttributeMatrix(path.getAttributeMatrixName())->getAttributeArray(path.getDataArrayName());
+    DataArray<uint8_t>::Pointer data = std::dynamic_pointer_cast<DataArray<uint8_t>>(array);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get());
+    uint8_t* buffer = data->getPointer(0);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t i = 0; i < dims[0] * dims[1]; i++)
+      {
+        buffer[z * dims[0] * dims[1] + i] = static_cast<uint8_t>((z + i) % 256);
+      }
+    }
+
+    AbstractFilter::Pointer filter = GetFilterByName("ITKImageWriter");
+    DREAM3D_REQUIRE_NE(filter.get(), 0);
+    QVariant var;
+    var.setValue(filename);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("FileName", var), true);
+    var.setValue(path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ImageArrayPath", var), true);
+    var.setValue(4);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NumberOfThreads", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    typedef itk::NumericSeriesFileNames NamesGeneratorType;
+    QString seriesfilename = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + "Threaded%03d.png";
+    NamesGeneratorType::Pointer namesGenerator = NamesGeneratorType::New();
+    namesGenerator->SetSeriesFormat(seriesfilename.toStdString());
+    namesGenerator->SetIncrementIndex(1);
+    namesGenerator->SetStartIndex(0);
+    namesGenerator->SetEndIndex(dims[2] - 1);
+    std::vector<std::string> listFileNames = namesGenerator->GetFileNames();
+    typedef itk::Image<uint8_t, 2> SliceType;
+    typedef itk::ImageFileReader<SliceType> ReaderType;
+    for(size_t z = 0; z < listFileNames.size(); z++)
+    {
+      this->FilesToRemove << QString(listFileNames[z].c_str());
+      ReaderType::Pointer reader = ReaderType::New();
+      reader->SetFileName(listFileNames[z]);
+      reader->Update();
+      SliceType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
+      DREAM3D_REQUIRE_EQUAL(size[0], dims[0]);
+      DREAM3D_REQUIRE_EQUAL(size[1], dims[1]);
+      const uint8_t* slice = reader->GetOutput()->GetBufferPointer();
+      for(size_t i = 0; i < dims[0] * dims[1]; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(slice[i], static_cast<uint8_t>((z + i) % 256));
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <class PixelType, unsigned int Dimension> qint64 TestWriteCompressedImage(const QString& suffix, int compressionLevel, int compressor, int expectedWarning)
+  {
+    QString filename = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + suffix;
+    DataArrayPath path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = CreateTestData<PixelType, Dimension>(path);
+    AbstractFilter::Pointer filter = GetFilterByName("ITKImageWriter");
+    DREAM3D_REQUIRE_NE(filter.get(), 0);
+    QVariant var;
+    var.setValue(filename);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("FileName", var), true);
+    var.setValue(path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ImageArrayPath", var), true);
+    var.setValue(compressionLevel);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("CompressionLevel", var), true);
+    var.setValue(compressor);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Compressor", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), ==, expectedWarning);
+    this->FilesToRemove << filename;
+    // Whatever the codec, the image read back is the one that was written
+    DREAM3D_REQUIRE(CompareImages<PixelType>(filename, containerArray, path));
+    return QFileInfo(filename).size();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteCompression()
+  {
+    // MetaImage: the level only enables or disables the compression
+    qint64 uncompressedSize = TestWriteCompressedImage<float, 3>("_level0.mha", 0, ITKImageWriter::DefaultCompressor, 0);
+    qint64 compressedSize = TestWriteCompressedImage<float, 3>("_default.mha", -1, ITKImageWriter::DefaultCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+    qint64 noneSize = TestWriteCompressedImage<float, 3>("_none.mha", -1, ITKImageWriter::NoCompressor, 0);
+    DREAM3D_REQUIRE_EQUAL(noneSize, uncompressedSize);
+    // Codecs that are specific to TIFF are ignored by the other formats
+    TestWriteCompressedImage<float, 3>("_lzw.mha", -1, ITKImageWriter::LZWCompressor, -21017);
+
+    // PNG: the level is passed to zlib
+    uncompressedSize = TestWriteCompressedImage<uint8_t, 2>("_level0.png", 0, ITKImageWriter::DefaultCompressor, 0);
+    compressedSize = TestWriteCompressedImage<uint8_t, 2>("_level9.png", 9, ITKImageWriter::DefaultCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+
+    // Chunked volume: the level is passed to zlib
+    uncompressedSize = TestWriteCompressedImage<float, 3>("_level0.cvol", 0, ITKImageWriter::DefaultCompressor, 0);
+    compressedSize = TestWriteCompressedImage<float, 3>("_level9.cvol", 9, ITKImageWriter::DefaultCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+
+    // TIFF: every codec
+    uncompressedSize = TestWriteCompressedImage<uint8_t, 2>("_none.tif", -1, ITKImageWriter::NoCompressor, 0);
+    compressedSize = TestWriteCompressedImage<uint8_t, 2>("_deflate.tif", -1, ITKImageWriter::DeflateCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+    compressedSize = TestWriteCompressedImage<uint8_t, 2>("_lzw.tif", -1, ITKImageWriter::LZWCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+    compressedSize = TestWriteCompressedImage<uint8_t, 2>("_packbits.tif", -1, ITKImageWriter::PackBitsCompressor, 0);
+    DREAM3D_REQUIRED(compressedSize, <, uncompressedSize);
+
+    // Invalid level
+    AbstractFilter::Pointer filter = GetFilterByName("ITKImageWriter");
+    DREAM3D_REQUIRE_NE(filter.get(), 0);
+    QVariant var;
+    var.setValue(UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + "_invalid.mha");
+    filter->setProperty("FileName", var);
+    var.setValue(10);
+    filter->setProperty("CompressionLevel", var);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), ==, -21014);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteInBackground()
+  {
+    QString filename = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + "_background.mha";
+    DataArrayPath path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = CreateTestData<float, 3>(path);
+    DataContainerArray::Pointer baselineContainerArray = CreateTestData<float, 3>(path);
+    AbstractFilter::Pointer filter = GetFilterByName("ITKImageWriter");
+    DREAM3D_REQUIRE_NE(filter.get(), 0);
+    QVariant var;
+    var.setValue(filename);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("FileName", var), true);
+    var.setValue(path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ImageArrayPath", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("WriteInBackground", var), true);
+    // The image is only written in background if filters run after the writer
+    AbstractFilter::Pointer lastFilter = GetFilterByName("ITKImageWriter");
+    filter->setNextFilter(lastFilter);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    this->FilesToRemove << filename;
+
+    // The filter wrote a copy: modifying the input while it is written does not change the file
+    IDataArray::Pointer array = containerArray->getDataContainer(path.getDataContainerName())->getAttributeMatrix(path.getAttributeMatrixName())->getAttributeArray(path.getDataArrayName());
+    std::dynamic_pointer_cast<DataArray<float>>(array)->initializeWithValue(-1.0f);
+
+    // The destructor of the filter waits for the write to be done
+    filter.reset();
+    DREAM3D_REQUIRE(CompareImages<float>(filename, baselineContainerArray, path));
+
+    // A second writer to the same file waits for the first one
+    filter = GetFilterByName("ITKImageWriter");
+    var.setValue(filename);
+    filter->setProperty("FileName", var);
+    var.setValue(path);
+    filter->setProperty("ImageArrayPath", var);
+    var.setValue(true);
+    filter->setProperty("WriteInBackground", var);
+    filter->setNextFilter(lastFilter);
+    filter->setDataContainerArray(baselineContainerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    AbstractFilter::Pointer secondFilter = GetFilterByName("ITKImageWriter");
+    var.setValue(filename);
+    secondFilter->setProperty("FileName", var);
+    var.setValue(path);
+    secondFilter->setProperty("ImageArrayPath", var);
+    secondFilter->setDataContainerArray(containerArray);
+    secondFilter->execute();
+    DREAM3D_REQUIRED(secondFilter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(secondFilter->getWarningCondition(), >=, 0);
+    filter.reset();
+    // The last write is the one of the second writer
+    DREAM3D_REQUIRE(CompareImages<float>(filename, containerArray, path));
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -492,6 +693,19 @@ public:
                       << "double";
     DREAM3D_REGISTER_TEST(TestWriteImage<3>("hdr", listHDRPixelTypes, "img"));
 
+    // Chunked volume
+    QStringList listChunkedPixelTypes;
+    listChunkedPixelTypes << "uint8_t"
+                          << "int8_t"
+                          << "uint16_t"
+                          << "int16_t"
+                          << "uint32_t"
+                          << "int32_t"
+                          << "float"
+                          << "double";
+    DREAM3D_REGISTER_TEST(TestWriteImage<3>("cvol", listChunkedPixelTypes));
+    DREAM3D_REGISTER_TEST(TestWriteImage<2>("cvol", listChunkedPixelTypes));
+
     // TIFF
     QStringList listTIFFPixelTypes;
     listTIFFPixelTypes << "uint8_t"
@@ -517,6 +731,11 @@ public:
 
     // Test image series
     DREAM3D_REGISTER_TEST(TestWriteImageSeries())
+    DREAM3D_REGISTER_TEST(TestWriteImageSeriesThreaded())
+
+    // Compression level and codec
+    DREAM3D_REGISTER_TEST(TestWriteCompression())
+    DREAM3D_REGISTER_TEST(TestWriteInBackground())
 
 #if REMOVE_TEST_FILES
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
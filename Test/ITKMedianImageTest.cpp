@@ -7,6 +7,9 @@
 #include "ITKTestBase.h"
 // Auto includes
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
+#include <SIMPLib/Geometry/ImageGeom.h>
+
+#include <algorithm>
 
 class ITKMedianImageTest : public ITKTestBase
 {
@@ -49,6 +52,122 @@ public:
     return 0;
   }
 
+  int TestITKMedianImagestreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKMedianImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(4);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    WriteImage("ITKMedianImagestreamed.nrrd", containerArray, input_path);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    // Streaming must not change the result: same hash as the "defaults" test.
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("cbc59611297961dea9f872282534f3df"));
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateMedianFilter(const DataArrayPath& input_path, bool saveAsNewArray)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKMedianImage");
+    if(nullptr == filterFactory.get())
+    {
+      return AbstractFilter::NullPointer();
+    }
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    filter->setProperty("SelectedCellArrayPath", var);
+    var.setValue(saveAsNewArray);
+    filter->setProperty("SaveAsNewArray", var);
+    return filter;
+  }
+
+  int TestITKMedianImageslicesTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    AttributeMatrix::Pointer attrMat = containerArray->getAttributeMatrix(input_path);
+    Int16ArrayType::Pointer inputArray = std::dynamic_pointer_cast<Int16ArrayType>(attrMat->getAttributeArray(input_path.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(inputArray.get());
+    QVector<size_t> tDims = attrMat->getTupleDimensions();
+    DREAM3D_REQUIRED(tDims[2], >, 1);
+    const size_t sliceSize = tDims[0] * tDims[1];
+    Int16ArrayType::Pointer inputCopy = std::dynamic_pointer_cast<Int16ArrayType>(inputArray->deepCopy());
+
+    // 3D image filtered slice by slice, with fewer threads than slices
+    AbstractFilter::Pointer filter = CreateMedianFilter(input_path, true);
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    QVariant var;
+    var.setValue(QString("Slices"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SliceBySlice", var), true);
+    var.setValue(2);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NumberOfThreads", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    Int16ArrayType::Pointer slicesArray = std::dynamic_pointer_cast<Int16ArrayType>(attrMat->getAttributeArray("Slices"));
+    DREAM3D_REQUIRE_VALID_POINTER(slicesArray.get());
+    // The input array is left untouched
+    DREAM3D_REQUIRE_EQUAL(std::equal(inputCopy->getPointer(0), inputCopy->getPointer(0) + inputCopy->getSize(), inputArray->getPointer(0)), true);
+
+    // Each slice must be filtered as the corresponding 2D image
+    const size_t slices[] = {0, tDims[2] / 2, tDims[2] - 1};
+    for(size_t slice : slices)
+    {
+      DataArrayPath slice_path("SliceContainer", "SliceAttributeMatrixName", "SliceAttributeArrayName");
+      QVector<size_t> sliceDims = {tDims[0], tDims[1], 1};
+      DataContainer::Pointer container = DataContainer::New(slice_path.getDataContainerName());
+      ImageGeom::Pointer imageGeometry = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      imageGeometry->setDimensions(sliceDims[0], sliceDims[1], sliceDims[2]);
+      container->setGeometry(imageGeometry);
+      AttributeMatrix::Pointer sliceAttrMat = container->createAndAddAttributeMatrix(sliceDims, slice_path.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+      Int16ArrayType::Pointer sliceArray = Int16ArrayType::CreateArray(sliceDims, QVector<size_t>(1, 1), slice_path.getDataArrayName(), true);
+      std::copy(inputCopy->getPointer(slice * sliceSize), inputCopy->getPointer(slice * sliceSize) + sliceSize, sliceArray->getPointer(0));
+      sliceAttrMat->addAttributeArray(slice_path.getDataArrayName(), sliceArray);
+      DataContainerArray::Pointer sliceContainerArray = DataContainerArray::New();
+      sliceContainerArray->addDataContainer(container);
+
+      AbstractFilter::Pointer sliceFilter = CreateMedianFilter(slice_path, false);
+      DREAM3D_REQUIRE_VALID_POINTER(sliceFilter.get());
+      sliceFilter->setDataContainerArray(sliceContainerArray);
+      sliceFilter->execute();
+      DREAM3D_REQUIRED(sliceFilter->getErrorCondition(), >=, 0);
+      Int16ArrayType::Pointer sliceOutput = std::dynamic_pointer_cast<Int16ArrayType>(sliceAttrMat->getAttributeArray(slice_path.getDataArrayName()));
+      DREAM3D_REQUIRE_VALID_POINTER(sliceOutput.get());
+      DREAM3D_REQUIRE_EQUAL(std::equal(sliceOutput->getPointer(0), sliceOutput->getPointer(0) + sliceSize, slicesArray->getPointer(slice * sliceSize)), true);
+    }
+    return 0;
+  }
+
   int TestITKMedianImageby23Test()
   {
     QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
@@ -99,6 +218,8 @@ public:
 
     DREAM3D_REGISTER_TEST(TestITKMedianImagedefaultsTest());
     DREAM3D_REGISTER_TEST(TestITKMedianImageby23Test());
+    DREAM3D_REGISTER_TEST(TestITKMedianImagestreamedTest());
+    DREAM3D_REGISTER_TEST(TestITKMedianImageslicesTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -0,0 +1,220 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+class ITKPixelExpressionImageTest : public ITKTestBase
+{
+
+public:
+  ITKPixelExpressionImageTest()
+  {
+  }
+  virtual ~ITKPixelExpressionImageTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateFilter(const QString& filtName, const DataArrayPath& input_path)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      return AbstractFilter::NullPointer();
+    }
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    filter->setProperty("SelectedCellArrayPath", var);
+    var.setValue(false);
+    filter->setProperty("SaveAsNewArray", var);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunExpression(const QString& expression, QString& md5Output)
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    AbstractFilter::Pointer filter = CreateFilter("ITKPixelExpressionImage", input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    QVariant var;
+    var.setValue(expression);
+    bool propWasSet = filter->setProperty("Expression", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKPixelExpressionImageShiftScaleTest()
+  {
+    // Same result as the "params" test of ITK::Shift Scale Image Filter (Shift: 100, Scale: 0.5)
+    QString md5Output;
+    DREAM3D_REQUIRE_EQUAL(RunExpression("shiftscale(x, 100, 0.5)", md5Output), 0);
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("e3bee902dc9339d28359ebfb96a70186"));
+    DREAM3D_REQUIRE_EQUAL(RunExpression("(x + 100) / 2", md5Output), 0);
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("e3bee902dc9339d28359ebfb96a70186"));
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKPixelExpressionImageFusedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+
+    // Reference: ITK::Abs Image Filter followed by ITK::Sqrt Image Filter
+    DataContainerArray::Pointer baselineArray = DataContainerArray::New();
+    this->ReadImage(input_filename, baselineArray, input_path);
+    QStringList filtNames = {"ITKAbsImage", "ITKSqrtImage"};
+    for(const QString& filtName : filtNames)
+    {
+      AbstractFilter::Pointer filter = CreateFilter(filtName, input_path);
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+      filter->setDataContainerArray(baselineArray);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    }
+    QString md5Baseline;
+    GetMD5FromDataContainer(baselineArray, input_path, md5Baseline);
+
+    // Same operations in a single pass, saved as a new array
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    AbstractFilter::Pointer filter = CreateFilter("ITKPixelExpressionImage", input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    QVariant var;
+    var.setValue(QString("sqrt(abs(x))"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Expression", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SaveAsNewArray", var), true);
+    var.setValue(QString("Expression"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", "Expression");
+    WriteImage("ITKPixelExpressionImageFused.nrrd", containerArray, output_path);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, output_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Baseline);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKPixelExpressionImageOutputTypeTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+
+    // Reference: ITK::Cast Image Filter to float, then the expression on the float array
+    DataContainerArray::Pointer baselineArray = DataContainerArray::New();
+    this->ReadImage(input_filename, baselineArray, input_path);
+    AbstractFilter::Pointer caster = CreateFilter("ITKCastImage", input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(caster.get());
+    QVariant var;
+    var.setValue(itk::ImageIOBase::IOComponentType::FLOAT - 1);
+    DREAM3D_REQUIRE_EQUAL(caster->setProperty("CastingType", var), true);
+    caster->setDataContainerArray(baselineArray);
+    caster->execute();
+    DREAM3D_REQUIRED(caster->getErrorCondition(), >=, 0);
+    AbstractFilter::Pointer filter = CreateFilter("ITKPixelExpressionImage", input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    var.setValue(QString("x / 3"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Expression", var), true);
+    filter->setDataContainerArray(baselineArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    QString md5Baseline;
+    GetMD5FromDataContainer(baselineArray, input_path, md5Baseline);
+
+    // Same expression on the short array, with a float output
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    filter = CreateFilter("ITKPixelExpressionImage", input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    var.setValue(QString("x / 3"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Expression", var), true);
+    // "same as input" comes first, then the component types in the order of ITK
+    var.setValue(itk::ImageIOBase::IOComponentType::FLOAT);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("OutputType", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    IDataArray::Pointer outputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(std::dynamic_pointer_cast<FloatArrayType>(outputArray).get());
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Baseline);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKPixelExpressionImageInvalidTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QStringList expressions = {"", "x +", "sqrt(x", "clamp(x, 0)", "y * 2", "x $ 2"};
+    for(const QString& expression : expressions)
+    {
+      AbstractFilter::Pointer filter = CreateFilter("ITKPixelExpressionImage", input_path);
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+      QVariant var;
+      var.setValue(expression);
+      DREAM3D_REQUIRE_EQUAL(filter->setProperty("Expression", var), true);
+      filter->setDataContainerArray(containerArray);
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20);
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKPixelExpressionImage"));
+
+    DREAM3D_REGISTER_TEST(TestITKPixelExpressionImageShiftScaleTest());
+    DREAM3D_REGISTER_TEST(TestITKPixelExpressionImageFusedTest());
+    DREAM3D_REGISTER_TEST(TestITKPixelExpressionImageOutputTypeTest());
+    DREAM3D_REGISTER_TEST(TestITKPixelExpressionImageInvalidTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKPixelExpressionImageTest(const ITKPixelExpressionImageTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKPixelExpressionImageTest&);              // Operator '=' Not Implemented
+};
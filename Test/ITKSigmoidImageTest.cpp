@@ -49,6 +49,44 @@ public:
     return 0;
   }
 
+  int TestITKSigmoidImagestreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/Ramp-Zero-One-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    IDataArray::Pointer inputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    QString filtName = "ITKSigmoidImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(4);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // The pieces of a pixel-wise filter are written straight in the selected array
+    IDataArray::Pointer outputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE(outputArray.get() == inputArray.get());
+    WriteImage("ITKSigmoidImagestreamed.nrrd", containerArray, input_path);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    // Streaming must not change the result: same hash as the "defaults" test.
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("c9222b9c9150e0d7a07e9de184c10167"));
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -59,6 +97,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKSigmoidImage"));
 
     DREAM3D_REGISTER_TEST(TestITKSigmoidImagedefaultsTest());
+    DREAM3D_REGISTER_TEST(TestITKSigmoidImagestreamedTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -51,6 +51,42 @@ public:
     return 0;
   }
 
+  int TestITKSignedMaurerDistanceMapImagestreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/2th_cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKSignedMaurerDistanceMapImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(4);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    // The distance map needs the whole image: the stream divisions are not used
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), -5);
+    WriteImage("ITKSignedMaurerDistanceMapImagestreamed.nrrd", containerArray, input_path);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_SignedMaurerDistanceMapImageFilter_default.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -61,6 +97,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKSignedMaurerDistanceMapImage"));
 
     DREAM3D_REGISTER_TEST(TestITKSignedMaurerDistanceMapImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKSignedMaurerDistanceMapImagestreamedTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
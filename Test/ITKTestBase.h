@@ -7,6 +7,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
+#include <QtCore/QtGlobal>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -27,6 +28,11 @@
 #include <itkTestingComparisonImageFilter.h>
 #include <itkTestingHashImageFilter.h>
 
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
 class ITKTestBase
 {
 
@@ -291,6 +297,90 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  // Number of floats between 'value1' and 'value2'
+  // -----------------------------------------------------------------------------
+  int64_t ComputeULPDistance(float value1, float value2)
+  {
+    int32_t bits[2];
+    std::memcpy(&bits[0], &value1, sizeof(float));
+    std::memcpy(&bits[1], &value2, sizeof(float));
+    // Negative floats are ordered backwards
+    const int64_t ordered1 = (bits[0] < 0 ? static_cast<int64_t>(INT32_MIN) - bits[0] : bits[0]);
+    const int64_t ordered2 = (bits[1] < 0 ? static_cast<int64_t>(INT32_MIN) - bits[1] : bits[1]);
+    return std::abs(ordered1 - ordered2);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs the unary math filter 'filtName' on the float image 'filename' with its SIMD kernel, then
+  // with the ITK filter (ITKIMAGEPROCESSING_SIMD set to "off"), and checks that the two results are
+  // at most 'maxULP' floats apart. NaN values must be NaN in both results.
+  // -----------------------------------------------------------------------------
+  int CompareUnaryMathKernelWithITK(const QString& filtName, const QString& filename, int64_t maxULP)
+  {
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(filename, containerArray, input_path);
+    const QString outputNames[2] = {"SIMDOutput", "ITKOutput"};
+    const bool hadSIMDVariable = qEnvironmentVariableIsSet("ITKIMAGEPROCESSING_SIMD");
+    const QByteArray simdVariable = qgetenv("ITKIMAGEPROCESSING_SIMD");
+    for(int i = 0; i < 2; i++)
+    {
+      FilterManager* fm = FilterManager::Instance();
+      IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+      DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+      AbstractFilter::Pointer filter = filterFactory->create();
+      QVariant var;
+      bool propWasSet;
+      var.setValue(input_path);
+      propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+      var.setValue(true);
+      propWasSet = filter->setProperty("SaveAsNewArray", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+      var.setValue(outputNames[i]);
+      propWasSet = filter->setProperty("NewCellArrayName", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+      if(i == 0)
+      {
+        qunsetenv("ITKIMAGEPROCESSING_SIMD");
+      }
+      else
+      {
+        qputenv("ITKIMAGEPROCESSING_SIMD", "off");
+      }
+      filter->setDataContainerArray(containerArray);
+      filter->execute();
+      if(hadSIMDVariable)
+      {
+        qputenv("ITKIMAGEPROCESSING_SIMD", simdVariable);
+      }
+      else
+      {
+        qunsetenv("ITKIMAGEPROCESSING_SIMD");
+      }
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+      DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    }
+    AttributeMatrix::Pointer attributeMatrix = containerArray->getAttributeMatrix(input_path);
+    FloatArrayType::Pointer simdArray = std::dynamic_pointer_cast<FloatArrayType>(attributeMatrix->getAttributeArray(outputNames[0]));
+    FloatArrayType::Pointer itkArray = std::dynamic_pointer_cast<FloatArrayType>(attributeMatrix->getAttributeArray(outputNames[1]));
+    DREAM3D_REQUIRE_VALID_POINTER(simdArray.get());
+    DREAM3D_REQUIRE_VALID_POINTER(itkArray.get());
+    DREAM3D_REQUIRE_EQUAL(simdArray->getSize(), itkArray->getSize());
+    for(size_t i = 0; i < simdArray->getSize(); i++)
+    {
+      const float simdValue = simdArray->getValue(i);
+      const float itkValue = itkArray->getValue(i);
+      DREAM3D_REQUIRE_EQUAL(std::isnan(simdValue), std::isnan(itkValue));
+      if(!std::isnan(simdValue))
+      {
+        DREAM3D_REQUIRED(ComputeULPDistance(simdValue, itkValue), <=, maxULP);
+      }
+    }
+    return 0;
+  }
+
   int ReadImage(const QString& filename, DataContainerArray::Pointer& containerArray, const DataArrayPath& path)
   {
     FilterPipeline::Pointer pipeline = FilterPipeline::New();
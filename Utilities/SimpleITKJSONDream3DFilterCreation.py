@@ -24,6 +24,7 @@ supported by this script.
 import json
 import argparse
 import os
+import re
 import sys
 
 general={
@@ -43,7 +44,8 @@ general={
                {'name':['template_code_filename'], 'type':str, 'required':True},  # 281
                {'name':['template_test_filename'], 'type':str, 'required':True}, # 280
                {'name':['filter_type'],'type':str,'required':False},  # 102 occurences
-               {'name':['measurements'],'type':str,'required':False}  # 109
+               {'name':['measurements'],'type':str,'required':False},  # 109
+               {'name':['pixel_types'], 'type':str, 'required':False}  # 337 occurences in JSON
              ],
         'ignored':
              [
@@ -55,7 +57,6 @@ general={
              ],
          'not_implemented':
              [
-               {'name':['pixel_types'], 'type':str, 'required':True},  # 337 occurences in JSON
                {'name':['vector_pixel_types_by_component'],'type':str,'required':False},  # 42
                {'name':['no_procedure'],'type':str,'required':False},  # 31
                {'name':['no_output_type'],'type':str,'required':False},  # 2
@@ -288,6 +289,118 @@ ValueAndDimensionTypes={
 
 CheckEntry=['CheckIntegerEntry','CheckVectorEntry']
 
+# Component types (DREAM3D_USE_* names in Dream3DTemplateAliasMacro.h) of the SimpleITK pixel ID type
+# lists that DREAM.3D supports as scalar images. When ITKImageProcessing_SIMPLEITK_PIXEL_TYPES is defined,
+# filters are only instantiated for the component types of the lists named in the 'pixel_types' field of
+# their JSON description.
+IntegerComponentTypes=['int8_t','uint8_t','int16_t','uint16_t','int32_t','uint32_t','int64_t','uint64_t']
+RealComponentTypes=['float','double']
+PixelIDTypeLists={
+'BasicPixelIDTypeList':IntegerComponentTypes+RealComponentTypes,
+'ScalarPixelIDTypeList':IntegerComponentTypes+RealComponentTypes,
+'NonLabelPixelIDTypeList':IntegerComponentTypes+RealComponentTypes,
+'IntegerPixelIDTypeList':IntegerComponentTypes,
+'UnsignedIntegerPixelIDTypeList':['uint8_t','uint16_t','uint32_t','uint64_t'],
+'SignedPixelIDTypeList':['int8_t','int16_t','int32_t','int64_t']+RealComponentTypes,
+'RealPixelIDTypeList':RealComponentTypes,
+}
+
+# Filters wrapped with ITKImageBase::filterCastToFloat: the ITK filter is always instantiated with float
+# images, so 'pixel_types' does not restrict the DREAM.3D arrays they accept.
+CastToFloatFilters=['CurvatureAnisotropicDiffusionImageFilter','CurvatureFlowImageFilter',
+                    'GradientAnisotropicDiffusionImageFilter','MinMaxCurvatureFlowImageFilter',
+                    'PatchBasedDenoisingImageFilter']
+
+# Pixel-wise filters processed by the SIMD kernels of itkUnaryMathKernels for float and double arrays
+UnaryMathKernels={
+'AbsImageFilter':'Abs',
+'SqrtImageFilter':'Sqrt',
+'SquareImageFilter':'Square',
+'ExpImageFilter':'Exp',
+'ExpNegativeImageFilter':'ExpNegative',
+'LogImageFilter':'Log',
+'SinImageFilter':'Sin',
+}
+
+# Number of image-sized float buffers (per pixel component) the ITK filter allocates on top of its output
+# image, returned by ITKImageBase::getInternalBufferFactor to estimate the peak memory of the filter
+InternalBufferFactors={
+'CurvatureAnisotropicDiffusionImageFilter':2.0,
+'CurvatureFlowImageFilter':2.0,
+'DanielssonDistanceMapImageFilter':5.0,
+'DiscreteGaussianImageFilter':2.0,
+'FFTNormalizedCorrelationImageFilter':12.0,
+'GradientAnisotropicDiffusionImageFilter':2.0,
+'GradientMagnitudeRecursiveGaussianImageFilter':2.0,
+'LaplacianRecursiveGaussianImageFilter':2.0,
+'MinMaxCurvatureFlowImageFilter':2.0,
+'MorphologicalWatershedFromMarkersImageFilter':2.0,
+'MorphologicalWatershedImageFilter':2.0,
+'MultiScaleHessianBasedObjectnessImageFilter':8.0,
+'SignedDanielssonDistanceMapImageFilter':10.0,
+'SignedMaurerDistanceMapImageFilter':1.0,
+'SmoothingRecursiveGaussianImageFilter':2.0,
+}
+
+# Filters that need their whole input image to compute any part of their output: ITKImageBase::isStreamable
+# returns false, with the reason as comment, and they always run in one piece
+NonStreamableFilters={
+'ApproximateSignedDistanceMapImageFilter':'The distance is propagated across the whole image',
+'BinaryClosingByReconstructionImageFilter':'The morphological reconstruction is propagated across the whole image',
+'BinaryMinMaxCurvatureFlowImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'BinaryOpeningByReconstructionImageFilter':'The morphological reconstruction is propagated across the whole image',
+'BinaryThinningImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'ClosingByReconstructionImageFilter':'The morphological reconstruction is propagated across the whole image',
+'ConnectedComponentImageFilter':'Labels are assigned over the whole image',
+'CurvatureAnisotropicDiffusionImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'CurvatureFlowImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'DanielssonDistanceMapImageFilter':'The distance is propagated across the whole image',
+'DoubleThresholdImageFilter':'The morphological reconstruction is propagated across the whole image',
+'FFTNormalizedCorrelationImageFilter':'The Fourier transforms need the whole image',
+'GradientAnisotropicDiffusionImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'GradientMagnitudeRecursiveGaussianImageFilter':'Recursive Gaussian filters run along whole image lines in every direction',
+'GrayscaleFillholeImageFilter':'The morphological reconstruction is propagated across the whole image',
+'GrayscaleGrindPeakImageFilter':'The morphological reconstruction is propagated across the whole image',
+'HConvexImageFilter':'The morphological reconstruction is propagated across the whole image',
+'HMaximaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'HMinimaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'LaplacianRecursiveGaussianImageFilter':'Recursive Gaussian filters run along whole image lines in every direction',
+'LaplacianSharpeningImageFilter':'The intensity statistics are computed on the whole image',
+'MinMaxCurvatureFlowImageFilter':'Each iteration needs the result of the previous one on the whole image',
+'MorphologicalWatershedFromMarkersImageFilter':'The flooding is propagated across the whole image',
+'MorphologicalWatershedImageFilter':'The flooding is propagated across the whole image',
+'MultiScaleHessianBasedObjectnessImageFilter':'Recursive Gaussian filters run along whole image lines in every direction',
+'NormalizeImageFilter':'The intensity statistics are computed on the whole image',
+'NormalizeToConstantImageFilter':'The intensity statistics are computed on the whole image',
+'OpeningByReconstructionImageFilter':'The morphological reconstruction is propagated across the whole image',
+'OtsuMultipleThresholdsImageFilter':'The intensity statistics are computed on the whole image',
+'RegionalMaximaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'RegionalMinimaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'RelabelComponentImageFilter':'Labels are assigned over the whole image',
+'RescaleIntensityImageFilter':'The intensity statistics are computed on the whole image',
+'SignedDanielssonDistanceMapImageFilter':'The distance is propagated across the whole image',
+'SignedMaurerDistanceMapImageFilter':'The distance is propagated across the whole image',
+'SmoothingRecursiveGaussianImageFilter':'Recursive Gaussian filters run along whole image lines in every direction',
+'ThresholdMaximumConnectedComponentsImageFilter':'Labels are assigned over the whole image',
+'ValuedRegionalMaximaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'ValuedRegionalMinimaImageFilter':'The morphological reconstruction is propagated across the whole image',
+'VectorConnectedComponentImageFilter':'Labels are assigned over the whole image',
+'VectorRescaleIntensityImageFilter':'The intensity statistics are computed on the whole image',
+}
+
+# Filters whose 2D version cannot be applied to each slice of a 3D image: ITKImageBase::canProcessSlicesIndependently
+# returns false, with the reason as comment
+NonSliceFilters={
+'ConnectedComponentImageFilter':'Components crossing slices would get a different label in each slice, and the labels of the slices would collide',
+'FFTNormalizedCorrelationImageFilter':'The second input image is not split into slices',
+'MaskImageFilter':'The second input image is not split into slices',
+'MorphologicalWatershedFromMarkersImageFilter':'The second input image is not split into slices',
+'MorphologicalWatershedImageFilter':'Basins crossing slices would get a different label in each slice, and the labels of the slices would collide',
+'RelabelComponentImageFilter':'The labels are sorted by the size of the objects in the whole image',
+'ThresholdMaximumConnectedComponentsImageFilter':'The threshold is chosen from the objects of the whole image',
+'VectorConnectedComponentImageFilter':'Components crossing slices would get a different label in each slice, and the labels of the slices would collide',
+}
+
 
 #
 def ExtractDescritpion(data_json, fields, filter_description, verbose=False, not_implemented=False):
@@ -524,7 +637,10 @@ def ImplementFilter(filter_description, filter_members, filter_measurements):
     # Code specific for each template
     if filter_description['template_code_filename'] == "KernelImageFilter":
         filt+='  filter->SetKernel(structuringElement);\n'
-    filt+='  this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);\n'
+    if filter_description['name'] in UnaryMathKernels:
+        filt+='  this->ITKImageBase::filterUnaryMath<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, ITKDream3DHelper::UnaryMathOperation::'+UnaryMathKernels[filter_description['name']]+');\n'
+    else:
+        filt+='  this->ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);\n'
     # Post processing (e.g. Print measurements)
     for filter_measurement in filter_measurements:
         filt+='  QString outputVal = "'+filter_measurement['name']+' :%1";\n'
@@ -540,6 +656,55 @@ def TypenameOutputPixelType(output_pixel_type):
     else:
         return '0'
 
+def DefinePixelTypes(filter_description):
+    """ Returns the DREAM3D_USE_* definitions restricting the component types the filter is
+    instantiated for when ITKImageProcessing_SIMPLEITK_PIXEL_TYPES is defined, or an empty string
+    if all of them are kept, if 'pixel_types' does not name any list of PixelIDTypeLists (e.g.
+    vector or label map lists) or if the filter casts its input to float.
+    """
+    if filter_description['name'] in CastToFloatFilters:
+        return ''
+    component_types=[]
+    for type_list in re.findall(r'\w+PixelIDTypeList', filter_description['pixel_types']):
+        if type_list in PixelIDTypeLists:
+            component_types += PixelIDTypeLists[type_list]
+    all_component_types=IntegerComponentTypes+RealComponentTypes
+    if len(component_types) == 0 or set(component_types) == set(all_component_types):
+        return ''
+    definitions='#ifdef ITKImageProcessing_SIMPLEITK_PIXEL_TYPES\n'
+    for component_type in all_component_types:
+        definitions += '#define DREAM3D_USE_'+component_type+' '+str(int(component_type in component_types))+'\n'
+    return definitions+'#endif\n\n'
+
+def GetOverrides(filter_description):
+    """ Returns the virtual functions of ITKImageBase reimplemented by the filter, as a list of
+    (return type, function name, body) tuples in the order they are written in the filter files.
+    """
+    name=filter_description['name']
+    overrides=[]
+    if name in InternalBufferFactors:
+        overrides.append(('double','getInternalBufferFactor','  return %.1f;\n'%InternalBufferFactors[name]))
+    if name in NonStreamableFilters:
+        overrides.append(('bool','isStreamable','  // '+NonStreamableFilters[name]+'\n  return false;\n'))
+    if name in NonSliceFilters:
+        overrides.append(('bool','canProcessSlicesIndependently','  // '+NonSliceFilters[name]+'\n  return false;\n'))
+    return overrides
+
+def DeclareOverrides(filter_description):
+    declarations=''
+    for return_type, function, body in GetOverrides(filter_description):
+        declarations+='\n  /**\n   * @brief '+function+' Reimplemented from @see ITKImageBase class\n   */\n'
+        declarations+='  virtual '+return_type+' '+function+'() const override;\n'
+    return declarations
+
+def DefineOverrides(filter_description):
+    definitions=''
+    for return_type, function, body in GetOverrides(filter_description):
+        definitions+='\n// -----------------------------------------------------------------------------\n//\n'
+        definitions+='// -----------------------------------------------------------------------------\n'
+        definitions+=return_type+' '+GetDREAM3DFilterName(filter_description['name'])+'::'+function+'() const\n{\n'+body+'}\n'
+    return definitions
+
 def ImplementInternal(filter_description, fct):
     if 'output_image_type' in filter_description and filter_description['output_image_type'] != '':
         return '  Dream3DArraySwitchMacroOutputType('+fct+', getSelectedCellArrayPath(), -4,'\
@@ -592,6 +757,7 @@ def InitializeParsingValues(DREAM3DFilter, filter_description):
     DREAM3DFilter['SetupFilterParameters'] = ''
     DREAM3DFilter['ReadFilterParameters'] = ''
     DREAM3DFilter['InitializationParameters'] = ''
+    DREAM3DFilter['BenchmarkParameters'] = ''
     DREAM3DFilter['CheckIntegerEntry'] = ''
     DREAM3DFilter['RegisterTests'] = ''
     DREAM3DFilter['FilterTests'] = ''
@@ -599,7 +765,10 @@ def InitializeParsingValues(DREAM3DFilter, filter_description):
     DREAM3DFilter['FilterParameterDescription'] = ''
     DREAM3DFilter['DataCheckInternal'] = ''
     DREAM3DFilter['FilterInternal'] = ''
+    DREAM3DFilter['OverrideDeclarations'] = ''
+    DREAM3DFilter['OverrideDefinitions'] = ''
     DREAM3DFilter['TestsIncludeName'] = ''
+    DREAM3DFilter['PixelTypeDefinitions'] = DefinePixelTypes(filter_description)
     if 'briefdescription' in filter_description:
         DREAM3DFilter['FilterDescription'] += filter_description['briefdescription']+'\n\n'
     if 'detaileddescription' in filter_description:
@@ -618,6 +787,18 @@ def GetDREAM3DInitializationParameters(filter_member):
     component_type = Dream3DTypeToMacro[output_type]['component']
     return '  m_'+filter_member['name']+'='+CastStdToDream3D[filter_member['dim_vec']]+'<'+input_type+','+output_type+','+component_type+'>('+str(filter_member['default'])+');\n'
 
+def GetDREAM3DBenchmarkParameters(filter_member):
+    type_conversion_dict = ITKToDream3DType[(filter_member['type'],filter_member['dim_vec'])]
+    input_type = type_conversion_dict['std']
+    output_type = type_conversion_dict['d3d']
+    component_type = Dream3DTypeToMacro[output_type]['component']
+    benchmarkCode = '    {\n'
+    benchmarkCode += '      '+output_type+' d3d_var = '+CastStdToDream3D[filter_member['dim_vec']]+'<'+input_type+','+output_type+','+component_type+'>('+str(filter_member['default'])+');\n'
+    benchmarkCode += '      var.setValue(d3d_var);\n'
+    benchmarkCode += '      filter->setProperty("'+filter_member['name']+'", var);\n'
+    benchmarkCode += '    }\n'
+    return benchmarkCode
+
 def GetOutputDirectory(directory):
     return os.path.join(directory, 'ITKImageProcessingFilters')
 
@@ -931,12 +1112,16 @@ def main(argv=None):
             DREAM3DFilter['ReadFilterParameters'] += GetDREAM3DReadFilterParameters(filter_member)
             # initialization
             DREAM3DFilter['InitializationParameters'] += GetDREAM3DInitializationParameters(filter_member)
+            # benchmark
+            DREAM3DFilter['BenchmarkParameters'] += GetDREAM3DBenchmarkParameters(filter_member)
             # Description
             DREAM3DFilter['FilterParameterDescription'] += GetDREAM3DParameterDescription(filter_member) +'\n'
         #filter
         DREAM3DFilter['Filter']=ImplementFilter(filter_description, filter_members, filter_measurements)
         DREAM3DFilter['FilterInternal']=ImplementInternal(filter_description, 'this->filter')
         DREAM3DFilter['DataCheckInternal']=ImplementInternal(filter_description, 'this->dataCheck')
+        DREAM3DFilter['OverrideDeclarations']=DeclareOverrides(filter_description)
+        DREAM3DFilter['OverrideDefinitions']=DefineOverrides(filter_description)
         #includes
         DREAM3DFilter['IncludeName']=FormatIncludes(include_list+member_include_list)
         DREAM3DFilter['TestsIncludeName']=FormatIncludes(member_include_list)
@@ -959,6 +1144,8 @@ def main(argv=None):
         # In SimpleITK, test rely on 'template_test_filename'. In this, we rely on 'template_code_filename'. This allows to include
         # definitions, enums,... that are included in SimpleITK and that would not be included here otherwise
         ConfigureFiles('Test.cpp', template_directory, testDirectory, DREAM3DFilter,  filter_description['template_code_filename'])
+        benchmarkDirectory = os.path.join(options.root_directory, 'Benchmarks')
+        ConfigureFiles('Benchmark.cpp', template_directory, benchmarkDirectory, DREAM3DFilter,  filter_description['template_code_filename'])
         ConfigureFiles('.md', template_directory, documentation_directory, DREAM3DFilter, "")  #
         # Append list of filters created
         filter_list.append(DREAM3DFilter['FilterName'])
@@ -967,6 +1154,7 @@ def main(argv=None):
     for filt in filter_list:
         print(filt)
     print("Update 'Test/TestFileLocations.h.in'")
+    print("Re-run CMake to add the generated benchmarks to the benchmark executable")
 
 if __name__=='__main__':
     main(sys.argv)
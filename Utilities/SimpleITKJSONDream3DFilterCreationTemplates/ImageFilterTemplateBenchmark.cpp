@@ -0,0 +1,35 @@
+// File automatically generated
+
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKBenchmarkBase.h"
+// Auto includes
+${TestsIncludeName}
+
+class ${FilterName}Benchmark : public ITKBenchmarkBase
+{
+
+public:
+  ${FilterName}Benchmark()
+  : ITKBenchmarkBase("${FilterName}")
+  {
+  }
+  virtual ~${FilterName}Benchmark()
+  {
+  }
+
+protected:
+  // -----------------------------------------------------------------------------
+  // Default values of the parameters in the JSON description of the filter
+  // -----------------------------------------------------------------------------
+  void SetParameters(AbstractFilter::Pointer filter) override
+  {
+    QVariant var;
+${BenchmarkParameters}  }
+
+private:
+  ${FilterName}Benchmark(const ${FilterName}Benchmark&); // Copy Constructor Not Implemented
+  void operator=(const ${FilterName}Benchmark&);         // Operator '=' Not Implemented
+};
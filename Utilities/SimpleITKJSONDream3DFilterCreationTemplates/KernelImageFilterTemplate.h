@@ -102,7 +102,7 @@ protected:
   * @brief Applies the filter
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
-
+${OverrideDeclarations}
 private:
   ${FilterName}(const ${FilterName}&);  // Copy Constructor Not Implemented
   void operator=(const ${FilterName}&); // Operator '=' Not Implemented